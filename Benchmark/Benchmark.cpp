@@ -0,0 +1,661 @@
+﻿#include <string>
+#include <cstdio>
+#include <cwchar>
+#include <map>
+import MasterQian.Tool.Benchmark;
+import MasterQian.Log;
+import MasterQian.Parser.Config;
+import MasterQian.Parser.Ini;
+using namespace MasterQian;
+using namespace MasterQian::Parser;
+using namespace MasterQian::Tool;
+
+// 100万个定时器，延迟在1毫秒到约1分钟之间，每次迭代全部添加后再全部取消
+struct TimerFixture {
+	static constexpr mqui32 Count{ 1000000U };
+
+	mqlist<mqui64> delays;
+
+	TimerFixture() noexcept {
+		delays.reserve(Count);
+		mqui64 seed{ 0x9E3779B97F4A7C15ULL };
+		for (mqui32 i{ }; i < Count; ++i) {
+			seed ^= seed << 13ULL;
+			seed ^= seed >> 7ULL;
+			seed ^= seed << 17ULL;
+			delays.add(10000ULL + seed % 600000000ULL);
+		}
+	}
+
+	static void __stdcall Callback(mqmem) noexcept { }
+};
+
+struct TimerWheelFixture : TimerFixture {
+	TimerWheel wheel;
+	mqlist<TimerId> ids;
+
+	void run() noexcept {
+		ids.clear();
+		for (auto delay : delays) {
+			ids.add(wheel.add(delay, Callback));
+		}
+		for (auto id : ids) {
+			wheel.cancel(id);
+		}
+		DoNotOptimize(wheel.size());
+	}
+};
+
+// 对照：以有序容器实现的超时表
+struct TimerMapFixture : TimerFixture {
+	std::multimap<mqui64, TimerCallBack> timers;
+	mqlist<std::multimap<mqui64, TimerCallBack>::iterator> ids;
+
+	void run() noexcept {
+		ids.clear();
+		auto now{ MonotonicClock::now() };
+		for (auto delay : delays) {
+			ids.add(timers.emplace(now + delay, Callback));
+		}
+		for (auto id : ids) {
+			timers.erase(id);
+		}
+		DoNotOptimize(timers.size());
+	}
+};
+
+// 时间戳与区域时间互转，每次重复转换1000万次，输入在4096个跨越约百年的时间中循环
+struct CivilFixture {
+	static constexpr mqui64 Count{ 10000000ULL };
+	static constexpr mqui32 Mask{ 4095U };
+
+	mqlist<Timestamp> stamps;
+	mqlist<Time> times;
+	mqui32 index{ };
+
+	CivilFixture() noexcept {
+		Timestamp ts{ 9466848000000000ULL }; // 2000-01-01
+		for (mqui32 i{ }; i <= Mask; ++i) {
+			ts += 7700000000000ULL + i * 123456789ULL; // 约9天
+			stamps.add(ts);
+			times.add(ts.local());
+		}
+	}
+};
+
+struct TimestampLocalFixture : CivilFixture {
+	void run() noexcept {
+		DoNotOptimize(stamps[index++ & Mask].local());
+	}
+};
+
+struct TimestampFromTimeFixture : CivilFixture {
+	void run() noexcept {
+		DoNotOptimize(Timestamp{ times[index++ & Mask] });
+	}
+};
+
+// 10万行日志的时间列，相邻行相隔0到约0.5秒，ISO-8601与nginx访问日志两种写法各一份，首次使用时生成
+struct TimeColumn {
+	static constexpr mqui32 Count{ 100000U };
+
+	std::string isoText, nginxText;
+	mqlist<std::string_view> iso, nginx;
+
+	TimeColumn() noexcept : iso(Count), nginx(Count) {
+		static constexpr char const* months[]{ "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+		static constexpr mqui64 IsoSize{ 29ULL }, NginxSize{ 26ULL };
+		isoText.resize(Count * IsoSize + 1ULL);
+		nginxText.resize(Count * NginxSize + 1ULL);
+		Timestamp ts{ 17059680000000000ULL }; // 北京时间2024-01-23 08:00:00
+		for (mqui32 i{ }; i < Count; ++i) {
+			ts += (i * 2654435761ULL % 500ULL) * 10000ULL;
+			auto t{ ts.local() };
+			auto a{ isoText.data() + i * IsoSize }, b{ nginxText.data() + i * NginxSize };
+			std::snprintf(a, IsoSize + 1ULL, "%04u-%02u-%02uT%02u:%02u:%02u.%03u+08:00",
+				t.year, t.month, t.day, t.hour, t.minute, t.second, t.millisecond);
+			std::snprintf(b, NginxSize + 1ULL, "%02u/%s/%04u:%02u:%02u:%02u +0800",
+				t.day, months[t.month - 1U], t.year, t.hour, t.minute, t.second);
+			iso.add(std::string_view{ a, IsoSize });
+			nginx.add(std::string_view{ b, NginxSize });
+		}
+	}
+
+	[[nodiscard]] static TimeColumn const& Get() noexcept {
+		static TimeColumn const column;
+		return column;
+	}
+};
+
+// 对照组，按YYYY-MM-DDTHH:MM:SS.fff±HH:MM的布局逐字符检查并累加数字，再按公历换算天数
+static bool NaiveParseISO(std::string_view str, Timestamp& ts) noexcept {
+	static constexpr std::string_view layout{ "0000-00-00T00:00:00.000+00:00" };
+	if (str.size() != layout.size()) return false;
+	mqi64 v[9]{ }, sign{ 1LL };
+	mqui32 field{ };
+	for (mqui64 i{ }; i < str.size(); ++i) {
+		auto c{ str[i] };
+		if (layout[i] == '0') {
+			if (c < '0' || c > '9') return false;
+			v[field] = v[field] * 10LL + (c - '0');
+		}
+		else if (layout[i] == '+') {
+			if (c != '+' && c != '-') return false;
+			sign = c == '-' ? -1LL : 1LL;
+			++field;
+		}
+		else {
+			if (c != layout[i]) return false;
+			++field;
+		}
+	}
+	auto y{ v[0] - (v[1] <= 2LL) };
+	auto era{ (y >= 0LL ? y : y - 399LL) / 400LL };
+	auto yoe{ y - era * 400LL };
+	auto doy{ (153LL * (v[1] + (v[1] > 2LL ? -3LL : 9LL)) + 2LL) / 5LL + v[2] - 1LL };
+	auto days{ era * 146097LL + yoe * 365LL + yoe / 4LL - yoe / 100LL + doy - 719468LL };
+	auto seconds{ days * 86400LL + v[3] * 3600LL + v[4] * 60LL + v[5] - sign * (v[7] * 3600LL + v[8] * 60LL) };
+	ts = Timestamp{ static_cast<mqui64>(seconds * 10000000LL + v[6] * 10000LL) };
+	return true;
+}
+
+// 每次迭代解析整列时间
+template<typename Parse>
+struct TimeParseFixture {
+	TimeColumn const* column{ };
+	mqarray<Timestamp> out;
+
+	TimeParseFixture() noexcept : out(TimeColumn::Count) { }
+
+	void setup() noexcept {
+		column = &TimeColumn::Get();
+	}
+
+	void run() noexcept {
+		DoNotOptimize(Parse{ }(*column, out.data()));
+	}
+};
+
+struct TimeParseEach {
+	mqui64 operator () (TimeColumn const& column, Timestamp* out) const noexcept {
+		mqui64 parsed{ };
+		for (mqui32 i{ }; i < TimeColumn::Count; ++i) {
+			parsed += ParseTimestamp(column.iso[i], out[i]);
+		}
+		return parsed;
+	}
+};
+
+struct TimeParseColumn {
+	mqui64 operator () (TimeColumn const& column, Timestamp* out) const noexcept {
+		return ParseTimestamps(column.iso.data(), TimeColumn::Count, out);
+	}
+};
+
+struct TimeParsePattern {
+	mqui64 operator () (TimeColumn const& column, Timestamp* out) const noexcept {
+		static TimePattern<char> const pattern{ "%d/%b/%Y:%H:%M:%S %z" };
+		return pattern.parse(column.nginx.data(), TimeColumn::Count, out);
+	}
+};
+
+struct TimeParseNaive {
+	mqui64 operator () (TimeColumn const& column, Timestamp* out) const noexcept {
+		mqui64 parsed{ };
+		for (mqui32 i{ }; i < TimeColumn::Count; ++i) {
+			parsed += NaiveParseISO(column.iso[i], out[i]);
+		}
+		return parsed;
+	}
+};
+
+// MasterQian.Time
+static void TimeBenchmark(Benchmark& bm) noexcept {
+	bm.Add(L"Time/MonotonicClock::ticks", [ ] () noexcept {
+		DoNotOptimize(MonotonicClock::ticks());
+	}).Add(L"Time/MonotonicClock::now", [ ] () noexcept {
+		DoNotOptimize(MonotonicClock::now());
+	}).Add(L"Time/Stopwatch::nanoseconds", [sw = Stopwatch{ }] () noexcept {
+		DoNotOptimize(sw.nanoseconds());
+	}).AddFixture<TimerWheelFixture>(L"Time/TimerWheel/1M add+cancel")
+		.AddFixture<TimerMapFixture>(L"Time/std::multimap/1M add+cancel")
+		.AddFixture<TimestampLocalFixture>(L"Time/Timestamp::local/10M", CivilFixture::Count)
+		.AddFixture<TimestampFromTimeFixture>(L"Time/Timestamp(Time)/10M", CivilFixture::Count)
+		.AddFixture<TimeParseFixture<TimeParseEach>>(L"Time/ParseTimestamp/100k ISO")
+		.AddFixture<TimeParseFixture<TimeParseColumn>>(L"Time/ParseTimestamps/100k ISO")
+		.AddFixture<TimeParseFixture<TimeParsePattern>>(L"Time/TimePattern::parse/100k nginx")
+		.AddFixture<TimeParseFixture<TimeParseNaive>>(L"Time/naive per-char/100k ISO");
+}
+
+// MasterQian.Log，每次迭代写100行到NUL，对比逐行写入与LogBatch合并写入
+static void LogBenchmark(Benchmark& bm) noexcept {
+	static FileLogger file{ L"NUL" };
+	bm.Add(L"Log/FileLogger/100 lines", [ ] () noexcept {
+		for (int i{ }; i < 100; ++i) {
+			file.i("request ", i, " done in ", 12.5, " ms");
+		}
+	}).Add(L"Log/LogBatch/100 lines", [ ] () noexcept {
+		auto batch{ file.batch() };
+		for (int i{ }; i < 100; ++i) {
+			batch.i("request ", i, " done in ", 12.5, " ms");
+		}
+	});
+	// 同一条纯ASCII的访问日志分别以窄字符、UTF-8与宽字符传入，经批量日志格式化为UTF-8，比较各自的转换开销
+	static constexpr std::string_view narrow{ "GET /api/v1/users/12345/orders?limit=50&offset=100 HTTP/1.1 200 OK upstream=10.0.3.17:8080" };
+	static constexpr std::u8string_view utf8{ u8"GET /api/v1/users/12345/orders?limit=50&offset=100 HTTP/1.1 200 OK upstream=10.0.3.17:8080" };
+	static constexpr std::wstring_view wide{ L"GET /api/v1/users/12345/orders?limit=50&offset=100 HTTP/1.1 200 OK upstream=10.0.3.17:8080" };
+	bm.Add(L"Log/LogBatch/ascii char/100 lines", [ ] () noexcept {
+		auto batch{ file.batch() };
+		for (int i{ }; i < 100; ++i) {
+			batch.i(narrow);
+		}
+	}).Add(L"Log/LogBatch/ascii char8_t/100 lines", [ ] () noexcept {
+		auto batch{ file.batch() };
+		for (int i{ }; i < 100; ++i) {
+			batch.i(utf8);
+		}
+	}).Add(L"Log/LogBatch/ascii wchar_t/100 lines", [ ] () noexcept {
+		auto batch{ file.batch() };
+		for (int i{ }; i < 100; ++i) {
+			batch.i(wide);
+		}
+	});
+}
+
+// 100万个键的配置，版本2、紧凑与旧格式各一份，相当于已映射到内存的配置文件，首次使用时生成
+struct ConfigFile {
+	static constexpr mqui32 Count{ 1000000U };
+
+	Bin v2, compact, v1;
+
+	ConfigFile() noexcept {
+		Config config;
+		for (mqui32 i{ }; i < Count; ++i) {
+			config.set(L"key" + std::to_wstring(i), i);
+		}
+		v2 = config.save();
+		compact = config.save(ConfigFormat::Compact);
+		v1 = config.save(ConfigFormat::V1);
+	}
+
+	[[nodiscard]] BinView bin(ConfigFormat format) const noexcept {
+		return format == ConfigFormat::V2 ? v2 : format == ConfigFormat::Compact ? compact : v1;
+	}
+
+	[[nodiscard]] static ConfigFile const& Get() noexcept {
+		static ConfigFile const file;
+		return file;
+	}
+};
+
+// 打开配置并查找一个键，不含读文件
+template<ConfigFormat format, bool view>
+struct ConfigOpenFixture {
+	ConfigFile const* file{ };
+
+	void setup() noexcept {
+		file = &ConfigFile::Get();
+	}
+
+	void run() noexcept {
+		BinView bv{ file->bin(format) };
+		if constexpr (view) {
+			ConfigView config{ bv };
+			DoNotOptimize(config.get(L"key123456", -1));
+		}
+		else {
+			Config config;
+			config.load(bv);
+			DoNotOptimize(config.get(L"key123456", -1));
+		}
+	}
+};
+
+// 1万个子配置，每个含8个键，子配置按紧凑格式嵌入，首次使用时生成
+struct ConfigNestedFile {
+	static constexpr mqui32 Count{ 10000U };
+
+	Bin v2, compact, v1;
+
+	ConfigNestedFile() noexcept {
+		Config config;
+		for (mqui32 i{ }; i < Count; ++i) {
+			Config section;
+			section.set(L"id", i);
+			section.set(L"port", 8000U + i % 1000U);
+			section.set(L"weight", i * 0.5);
+			section.set(L"enabled", i % 2U);
+			section.set(L"retry", 3U);
+			section.set(L"timeout", 30U);
+			section.set(L"name", std::wstring_view{ L"server" });
+			section.set(L"zone", std::wstring_view{ L"east" });
+			config.set(L"section" + std::to_wstring(i), section);
+		}
+		v2 = config.save();
+		compact = config.save(ConfigFormat::Compact);
+		v1 = config.save(ConfigFormat::V1);
+	}
+
+	[[nodiscard]] BinView bin(ConfigFormat format) const noexcept {
+		return format == ConfigFormat::V2 ? v2 : format == ConfigFormat::Compact ? compact : v1;
+	}
+
+	[[nodiscard]] static ConfigNestedFile const& Get() noexcept {
+		static ConfigNestedFile const file;
+		return file;
+	}
+};
+
+// 打开含子配置的配置并读取每个子配置的一个键
+template<ConfigFormat format, bool view>
+struct ConfigNestedFixture {
+	ConfigNestedFile const* file{ };
+
+	void setup() noexcept {
+		file = &ConfigNestedFile::Get();
+	}
+
+	void run() noexcept {
+		BinView bv{ file->bin(format) };
+		mqui64 sum{ };
+		if constexpr (view) {
+			ConfigView config{ bv };
+			for (mqui32 i{ }; i < ConfigNestedFile::Count; i += 97U) {
+				sum += config.get_config(L"section" + std::to_wstring(i)).get(L"port", 0U);
+			}
+		}
+		else {
+			Config config;
+			config.load(bv);
+			for (mqui32 i{ }; i < ConfigNestedFile::Count; i += 97U) {
+				sum += config.get_config(L"section" + std::to_wstring(i)).get(L"port", 0U);
+			}
+		}
+		DoNotOptimize(sum);
+	}
+};
+
+// 默认、站点与用户三层配置，各10万个键，部分重叠，首次使用时生成
+struct ConfigLayers {
+	static constexpr mqui32 Count{ 100000U };
+
+	Config layers[3];
+	Bin bins[3];
+
+	ConfigLayers() noexcept {
+		for (mqui32 i{ }; i < Count; ++i) {
+			layers[0].set(L"key" + std::to_wstring(i), i);
+			layers[1].set(L"key" + std::to_wstring(i * 2U), i);
+			layers[2].set(L"key" + std::to_wstring(i * 3U + Count / 2U), i);
+		}
+		for (mqui32 i{ }; i < 3U; ++i) {
+			bins[i] = layers[i].save();
+		}
+	}
+
+	[[nodiscard]] static ConfigLayers const& Get() noexcept {
+		static ConfigLayers const layers;
+		return layers;
+	}
+};
+
+// 合并三层配置
+struct ConfigMergeFixture {
+	ConfigLayers const* layers{ };
+
+	void setup() noexcept {
+		layers = &ConfigLayers::Get();
+	}
+
+	void run() noexcept {
+		Config config;
+		for (auto& layer : layers->layers) {
+			config.merge(layer);
+		}
+		DoNotOptimize(config.size());
+	}
+};
+
+// 直接合并三层配置的序列化视图
+struct ConfigMergeViewFixture : ConfigMergeFixture {
+	void run() noexcept {
+		Config config;
+		for (auto& bin : layers->bins) {
+			config.merge(ConfigView{ bin });
+		}
+		DoNotOptimize(config.size());
+	}
+};
+
+// 对照：逐项取值再设置
+struct ConfigMergeLoopFixture : ConfigMergeFixture {
+	void run() noexcept {
+		Config config;
+		for (auto& layer : layers->layers) {
+			for (auto& [key, value] : layer) {
+				config.set(key, layer.get(key, 0U));
+			}
+		}
+		DoNotOptimize(config.size());
+	}
+};
+
+// MasterQian.Parser.Config
+static void ConfigBenchmark(Benchmark& bm) noexcept {
+	bm.AddFixture<ConfigOpenFixture<ConfigFormat::V2, true>>(L"Config/ConfigView V2/1M open+lookup")
+		.AddFixture<ConfigOpenFixture<ConfigFormat::Compact, true>>(L"Config/ConfigView Compact/1M open+lookup")
+		.AddFixture<ConfigOpenFixture<ConfigFormat::V1, true>>(L"Config/ConfigView V1/1M open+lookup")
+		.AddFixture<ConfigOpenFixture<ConfigFormat::V2, false>>(L"Config/Config::load V2/1M open+lookup")
+		.AddFixture<ConfigOpenFixture<ConfigFormat::Compact, false>>(L"Config/Config::load Compact/1M open+lookup")
+		.AddFixture<ConfigOpenFixture<ConfigFormat::V1, false>>(L"Config/Config::load V1/1M open+lookup")
+		.AddFixture<ConfigNestedFixture<ConfigFormat::V2, true>>(L"Config/ConfigView V2/10k nested open+lookup")
+		.AddFixture<ConfigNestedFixture<ConfigFormat::Compact, true>>(L"Config/ConfigView Compact/10k nested open+lookup")
+		.AddFixture<ConfigNestedFixture<ConfigFormat::V1, true>>(L"Config/ConfigView V1/10k nested open+lookup")
+		.AddFixture<ConfigNestedFixture<ConfigFormat::V2, false>>(L"Config/Config::load V2/10k nested open+lookup")
+		.AddFixture<ConfigNestedFixture<ConfigFormat::Compact, false>>(L"Config/Config::load Compact/10k nested open+lookup")
+		.AddFixture<ConfigNestedFixture<ConfigFormat::V1, false>>(L"Config/Config::load V1/10k nested open+lookup")
+		.AddFixture<ConfigMergeFixture>(L"Config/merge/3x100k")
+		.AddFixture<ConfigMergeViewFixture>(L"Config/merge ConfigView/3x100k")
+		.AddFixture<ConfigMergeLoopFixture>(L"Config/get+set loop/3x100k");
+}
+
+// 约800万字符的ini文本，宽字符与单字节各一份，首次使用时生成
+struct IniText {
+	std::wstring wide;
+	std::string narrow;
+
+	IniText() noexcept {
+		for (mqui32 s{ }; wide.size() < (8ULL << 20ULL); ++s) {
+			wide += L"[section " + std::to_wstring(s) + L"]\r\n";
+			wide += L"; comment for section " + std::to_wstring(s) + L"\r\n";
+			for (mqui32 k{ }; k < 16U; ++k) {
+				wide += L"  key" + std::to_wstring(k) + L" = value " + std::to_wstring(s * 16U + k) + L" with some text\r\n";
+			}
+			wide += L"\r\n";
+		}
+		narrow.assign(wide.begin(), wide.end());
+	}
+
+	[[nodiscard]] static IniText const& Get() noexcept {
+		static IniText const text;
+		return text;
+	}
+};
+
+// 对照：向量化之前逐字符扫描行尾、去空白并rfind('=')的解析，建表方式与Ini::Load相同
+static bool IniLoadScalar(std::wstring_view data, Parser::Ini& ini) noexcept {
+	auto blank = [ ] (wchar_t c) noexcept { return c == L' ' || c == L'\t'; };
+	auto newline = [ ] (wchar_t c) noexcept { return c == L'\r' || c == L'\n'; };
+	ini.clear();
+	Parser::Section* section{ };
+	for (auto p{ data.data() }, last{ data.data() + data.size() }; p != last; ) {
+		auto start{ p };
+		while (p != last && !newline(*p)) ++p;
+		auto end{ p };
+		while (start != end && blank(*start)) ++start;
+		while (end != start && blank(end[-1])) --end;
+		while (p != last && newline(*p)) ++p;
+		std::wstring_view line{ start, static_cast<mqui64>(end - start) };
+		if (line.empty() || line.front() == L';') continue;
+		if (line.size() > 1ULL && line.front() == L'[' && line.back() == L']') {
+			auto b{ start + 1 }, e{ end - 1 };
+			while (b != e && blank(*b)) ++b;
+			while (e != b && blank(e[-1])) --e;
+			section = &ini.try_emplace(std::wstring(b, e)).first->second;
+		}
+		else if (auto pos{ line.rfind(L'=') }; pos != std::wstring_view::npos && section) {
+			auto key{ start + pos }, value{ start + pos + 1ULL };
+			while (key != start && blank(key[-1])) --key;
+			while (value != end && blank(*value)) ++value;
+			if (key == start) return false;
+			section->insert_or_assign(std::wstring(start, key), std::wstring(value, end));
+		}
+		else return false;
+	}
+	return true;
+}
+
+// 每次迭代完整解析一遍IniText
+template<typename Parse>
+struct IniParseFixture {
+	IniText const* text{ };
+
+	void setup() noexcept {
+		text = &IniText::Get();
+	}
+
+	void run() noexcept {
+		DoNotOptimize(Parse{ }(*text));
+	}
+};
+
+struct IniViewAParse {
+	mqui64 operator () (IniText const& text) const noexcept {
+		Parser::IniViewA view;
+		view.Load(text.narrow);
+		return view.size();
+	}
+};
+
+struct IniViewParse {
+	mqui64 operator () (IniText const& text) const noexcept {
+		Parser::IniView view;
+		view.Load(text.wide);
+		return view.size();
+	}
+};
+
+struct IniParse {
+	mqui64 operator () (IniText const& text) const noexcept {
+		Parser::Ini ini;
+		ini.Load(text.wide);
+		return ini.size();
+	}
+};
+
+template<mqui32 threads>
+struct IniParallelParse {
+	mqui64 operator () (IniText const& text) const noexcept {
+		Parser::Ini ini;
+		ini.LoadParallel(text.wide, threads);
+		return ini.size();
+	}
+};
+
+struct IniScalarParse {
+	mqui64 operator () (IniText const& text) const noexcept {
+		Parser::Ini ini;
+		IniLoadScalar(text.wide, ini);
+		return ini.size();
+	}
+};
+
+// MasterQian.Parser.Ini
+static void IniBenchmark(Benchmark& bm) noexcept {
+	bm.AddFixture<IniParseFixture<IniViewAParse>>(L"Ini/IniViewA::Load")
+		.AddFixture<IniParseFixture<IniViewParse>>(L"Ini/IniView::Load")
+		.AddFixture<IniParseFixture<IniParse>>(L"Ini/Ini::Load")
+		.AddFixture<IniParseFixture<IniParallelParse<1U>>>(L"Ini/Ini::LoadParallel/1 thread")
+		.AddFixture<IniParseFixture<IniParallelParse<2U>>>(L"Ini/Ini::LoadParallel/2 threads")
+		.AddFixture<IniParseFixture<IniParallelParse<4U>>>(L"Ini/Ini::LoadParallel/4 threads")
+		.AddFixture<IniParseFixture<IniParallelParse<8U>>>(L"Ini/Ini::LoadParallel/8 threads")
+		.AddFixture<IniParseFixture<IniParallelParse<16U>>>(L"Ini/Ini::LoadParallel/16 threads")
+		.AddFixture<IniParseFixture<IniScalarParse>>(L"Ini/Ini::Load scalar (pre-SSE2)");
+}
+
+// 输出各格式的配置文件大小，运行了配置用例时才生成
+static void ConfigSizes(mqlist<BenchmarkResult> const& results) noexcept {
+	bool open{ }, nested{ };
+	for (auto& result : results) {
+		open = open || result.name.ends_with(L"/1M open+lookup");
+		nested = nested || result.name.ends_with(L"/10k nested open+lookup");
+	}
+	if (open) {
+		auto& file{ ConfigFile::Get() };
+		std::printf("%-42s V2 %llu B, Compact %llu B, V1 %llu B\n", "Config/1M size", file.v2.size(), file.compact.size(), file.v1.size());
+	}
+	if (nested) {
+		auto& file{ ConfigNestedFile::Get() };
+		std::printf("%-42s V2 %llu B, Compact %llu B, V1 %llu B\n", "Config/10k nested size", file.v2.size(), file.compact.size(), file.v1.size());
+	}
+}
+
+// 输出Ini解析的吞吐量，单字节文本按字符数、宽字符文本按两倍字符数计算字节
+static void IniThroughput(mqlist<BenchmarkResult> const& results) noexcept {
+	for (auto& result : results) {
+		if (!result.name.starts_with(L"Ini/") || result.mean <= 0.0) continue;
+		auto chars{ static_cast<double>(IniText::Get().wide.size()) };
+		auto bytes{ result.name.starts_with(L"Ini/IniViewA") ? chars : chars * sizeof(wchar_t) };
+		std::printf("%-42ls %10.1f MB/s\n", result.name.c_str(), bytes / result.mean * 1e9 / (1 << 20));
+	}
+}
+
+// 比较两次运行的结果文件，存在显著变慢时返回1，文件无法读取时返回2
+static int Compare(int argc, wchar_t** argv) noexcept {
+	mqlist<BenchmarkResult> baseline, contender;
+	if (!BenchmarkLoad(argv[2], baseline) || !BenchmarkLoad(argv[3], contender)) {
+		std::fputs("cannot read benchmark result files\n", stderr);
+		return 2;
+	}
+	auto alpha{ argc > 4 ? std::wcstod(argv[4], nullptr) : 0.05 };
+	auto threshold{ argc > 5 ? std::wcstod(argv[5], nullptr) : 0.0 };
+	auto comparisons{ BenchmarkCompare(baseline, contender, alpha, threshold) };
+	std::fputs(BenchmarkCompareReport(comparisons).c_str(), stdout);
+	for (auto& c : comparisons) {
+		if (c.regression) return 1;
+	}
+	return 0;
+}
+
+// 用法:
+//   Benchmark.exe [名称过滤] [--json=文件] [--csv=文件] [--counters]
+//   Benchmark.exe compare 基准文件 对比文件 [显著性水平=0.05] [最小变慢比例=0]
+int wmain(int argc, wchar_t** argv) {
+	if (argc > 3 && std::wstring_view{ argv[1] } == L"compare") {
+		return Compare(argc, argv);
+	}
+	Benchmark bm;
+	for (int i{ 1 }; i < argc; ++i) {
+		std::wstring_view arg{ argv[i] };
+		if (arg.starts_with(L"--json=")) {
+			bm.Output(arg.substr(7ULL), BenchmarkFormat::JSON);
+		}
+		else if (arg.starts_with(L"--csv=")) {
+			bm.Output(arg.substr(6ULL), BenchmarkFormat::CSV);
+		}
+		else if (arg == L"--counters") {
+			bm.Counters();
+		}
+		else {
+			bm.Filter(arg);
+		}
+	}
+	TimeBenchmark(bm);
+	LogBenchmark(bm);
+	ConfigBenchmark(bm);
+	IniBenchmark(bm);
+	auto results{ bm.Run() };
+	ConfigSizes(results);
+	IniThroughput(results);
+	return 0;
+}
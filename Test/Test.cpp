@@ -4,13 +4,64 @@ import MasterQian.Log;
 import MasterQian.Storage.Path;
 import MasterQian.Time;
 import MasterQian.System;
+import MasterQian.Parser.Ini;
 using namespace MasterQian;
 
+// Ini::LoadParallel只在节行处切分，以'['开头的项、注释、行首空白与各种换行下结果与Load一致
+static bool TestIniLoadParallel() {
+	std::wstring data;
+	for (int s{ }; data.size() < (4ULL << 20ULL); ++s) {
+		data += L"  [sec" + std::to_wstring(s % 97) + L"]\r\n";
+		data += L"; [comment]\r\n";
+		data += L"[key" + std::to_wstring(s % 13) + L"] = value\n";
+		data += L"\t[x]=[y" + std::to_wstring(s % 7) + L"]\r";
+		for (int k{ }; k < 8; ++k) {
+			data += L"k" + std::to_wstring(k) + L" = [v" + std::to_wstring(s) + L"]\r\n";
+		}
+		data += L"\r\n[literal] = [\r\n";
+	}
+	Parser::Ini serial;
+	auto error{ serial.Load(data) };
+	for (mqui32 threads : { 2U, 3U, 4U, 8U, 16U }) {
+		Parser::Ini parallel;
+		if (parallel.LoadParallel(data, threads) != error || parallel != serial) return false;
+	}
+	data.insert(data.size() / 2ULL, L"\r\n[broken\r\n");
+	Parser::Ini broken;
+	return error == Parser::IniError::OK && broken.LoadParallel(data, 4U) == broken.Load(data);
+}
+
+// IniDocument在同一偏移处既有插入又有删除：节a的新项插在第二个[b]之前，该节头随节b一同删除
+static bool TestIniDocumentSamePosition() {
+	Parser::IniDocument doc(L"[b]\nb=1\n[a]\na=1\n[b]\nc=2\n");
+	doc.remove(L"b");
+	doc.set(L"a", L"k", L"v");
+	doc.set(L"a", L"a", L"2");
+	doc.set(L"a", L"a", L"3");
+	auto list{ doc.changes() };
+	for (mqui64 i{ 1ULL }; i < list.size(); ++i) {
+		if (list[i].offset < list[i - 1ULL].offset + list[i - 1ULL].size) return false;
+	}
+	return doc.Save() == L"[a]\na=3\nk=v\n";
+}
+
 #if 0
 #else
 #pragma optimize("",off)
 #endif
 int main() {
 	console.i(L"123"_utf8);
-	return 0;
+	bool ok{ true };
+	for (auto [name, test] : {
+		std::pair{ L"Ini::LoadParallel", TestIniLoadParallel },
+		std::pair{ L"IniDocument::Save same position", TestIniDocumentSamePosition } }) {
+		if (test()) {
+			console.i(name, L" OK");
+		}
+		else {
+			console.e(name, L" FAILED");
+			ok = false;
+		}
+	}
+	return ok ? 0 : 1;
 }
\ No newline at end of file
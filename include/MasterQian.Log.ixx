@@ -1,10 +1,13 @@
 module;
 #include "MasterQian.Meta.h"
 #include <string>
+#include <charconv>
+#include <atomic>
 #define MasterQianModuleVersion 20240131ULL
 
 export module MasterQian.Log;
 export import MasterQian.freestanding;
+import MasterQian.Time;
 
 export namespace MasterQian {
 	// ־
@@ -12,6 +15,9 @@ export namespace MasterQian {
 		STD_CONSOLE, // ̨־
 		DEBUG_CONSOLE, // Դ־
 		FILE, // ļ־
+		APPEND_FILE, // ׷ļ־
+		ANSI_CONSOLE, // ANSIתɫĿ̨־
+		RING_FILE, // ڴӳ价ļ־
 	};
 
 	// ־ǩ
@@ -20,6 +26,12 @@ export namespace MasterQian {
 		WARNING, // 
 		ERR // 
 	};
+
+	// ṹ־ʽ
+	enum class LogFormat : mqenum {
+		JSON, // JSON Linesÿһ
+		LOGFMT, // key=value
+	};
 }
 
 namespace MasterQian::api {
@@ -29,12 +41,28 @@ namespace MasterQian::api {
 	META_WINAPI(mqbool, WriteFile, mqhandle, mqcmem, mqui32, mqui32*, mqhandle);
 	META_WINAPI(mqbool, WriteConsoleW, mqhandle, mqcmem, mqui32, mqui32*, mqmem);
 	META_WINAPI(mqbool, SetConsoleTextAttribute, mqhandle, mqui16);
+	META_WINAPI(mqbool, GetConsoleMode, mqhandle, mqui32*);
+	META_WINAPI(mqbool, SetConsoleMode, mqhandle, mqui32);
 	META_WINAPI(void, OutputDebugStringW, mqcstr);
+	META_WINAPI(mqui32, GetCurrentThreadId);
+	META_WINAPI(mqbool, ReadFile, mqhandle, mqmem, mqui32, mqui32*, mqhandle);
+	META_WINAPI(mqbool, GetFileSizeEx, mqhandle, mqi64*);
+	META_WINAPI(mqhandle, CreateFileMappingW, mqhandle, mqmem, mqui32, mqui32, mqui32, mqcstr);
+	META_WINAPI(mqmem, MapViewOfFile, mqhandle, mqui32, mqui32, mqui32, mqui64);
+	META_WINAPI(mqbool, UnmapViewOfFile, mqcmem);
 
 #pragma comment(linker,"/alternatename:__imp_?OutputDebugStringW@api@MasterQian@@YAXPEB_W@Z::<!MasterQian.Log>=__imp_OutputDebugStringW")
+#pragma comment(linker,"/alternatename:__imp_?GetCurrentThreadId@api@MasterQian@@YAIXZ::<!MasterQian.Log>=__imp_GetCurrentThreadId")
+#pragma comment(linker,"/alternatename:__imp_?ReadFile@api@MasterQian@@YAHPEAX0IPEAI0@Z::<!MasterQian.Log>=__imp_ReadFile")
+#pragma comment(linker,"/alternatename:__imp_?GetFileSizeEx@api@MasterQian@@YAHPEAXPEA_J@Z::<!MasterQian.Log>=__imp_GetFileSizeEx")
+#pragma comment(linker,"/alternatename:__imp_?CreateFileMappingW@api@MasterQian@@YAPEAXPEAX0IIIPEB_W@Z::<!MasterQian.Log>=__imp_CreateFileMappingW")
+#pragma comment(linker,"/alternatename:__imp_?MapViewOfFile@api@MasterQian@@YAPEAXPEAXIII_K@Z::<!MasterQian.Log>=__imp_MapViewOfFile")
+#pragma comment(linker,"/alternatename:__imp_?UnmapViewOfFile@api@MasterQian@@YAHPEBX@Z::<!MasterQian.Log>=__imp_UnmapViewOfFile")
 #pragma comment(linker,"/alternatename:__imp_?WriteFile@api@MasterQian@@YAHPEAXPEBXIPEAI0@Z::<!MasterQian.Log>=__imp_WriteFile")
 #pragma comment(linker,"/alternatename:__imp_?WriteConsoleW@api@MasterQian@@YAHPEAXPEBXIPEAI0@Z::<!MasterQian.Log>=__imp_WriteConsoleW")
 #pragma comment(linker,"/alternatename:__imp_?SetConsoleTextAttribute@api@MasterQian@@YAHPEAXG@Z::<!MasterQian.Log>=__imp_SetConsoleTextAttribute")
+#pragma comment(linker,"/alternatename:__imp_?GetConsoleMode@api@MasterQian@@YAHPEAXPEAI@Z::<!MasterQian.Log>=__imp_GetConsoleMode")
+#pragma comment(linker,"/alternatename:__imp_?SetConsoleMode@api@MasterQian@@YAHPEAXI@Z::<!MasterQian.Log>=__imp_SetConsoleMode")
 #pragma comment(linker,"/alternatename:__imp_?CloseHandle@api@MasterQian@@YAHPEAX@Z::<!MasterQian.Log>=__imp_CloseHandle")
 #pragma comment(linker,"/alternatename:__imp_?CreateFileW@api@MasterQian@@YAPEAXPEB_WIIPEAXII1@Z::<!MasterQian.Log>=__imp_CreateFileW")
 #pragma comment(linker,"/alternatename:__imp_?GetStdHandle@api@MasterQian@@YAPEAXI@Z::<!MasterQian.Log>=__imp_GetStdHandle")
@@ -57,6 +85,19 @@ namespace MasterQian::details {
 		buf += sv;
 	}
 
+	// UTF-8
+	inline void LoggerLogValue(std::wstring& buf, std::string_view sv) {
+		if (auto len{ api::MultiByteToWideChar(65001U, 0, sv.data(), static_cast<mqi32>(sv.size()), nullptr, 0) }; len > 0) {
+			auto pos{ buf.size() };
+			buf.resize(pos + static_cast<mqui64>(len));
+			api::MultiByteToWideChar(65001U, 0, sv.data(), static_cast<mqi32>(sv.size()), buf.data() + pos, len);
+		}
+	}
+
+	inline void LoggerLogValue(std::wstring& buf, std::u8string_view sv) {
+		LoggerLogValue(buf, std::string_view{ reinterpret_cast<mqcstra>(sv.data()), sv.size() });
+	}
+
 	template<typename T>
 	concept log_userstruct_func = requires (std::wstring & buf, freestanding::remove_cvref<T> const t) {
 		{ Log(buf, t) } noexcept -> freestanding::same<void>;
@@ -99,35 +140,23 @@ namespace MasterQian::details {
 		}
 	}
 
-	inline mqhandle CreateLogger(LogType type, mqcmem arg) noexcept {
-		switch (type) {
-		case LogType::STD_CONSOLE: {
+	/*    ־ˣÿ־ڱѡӦʵ    */
+
+	template<LogType type>
+	struct LogSink;
+
+	// ̨Կ̨ɫַ
+	template<>
+	struct LogSink<LogType::STD_CONSOLE> {
+		static constexpr bool utf8{ false };
+
+		static mqhandle open(mqcmem) noexcept {
 			return api::GetStdHandle(static_cast<mqui32>(-11));
 		}
-		case LogType::DEBUG_CONSOLE: {
-			return reinterpret_cast<mqhandle>(5201314U);
-		}
-		case LogType::FILE: {
-			if (arg) {
-				auto hFile{ api::CreateFileW(static_cast<mqcstr>(arg), 0x40000000U, 0,
-					nullptr, 2U, 0x00000080U, nullptr) };
-				return hFile != reinterpret_cast<mqhandle>(-1) ? hFile : nullptr;
-			}
-			break;
-		}
-		}
-		return nullptr;
-	}
 
-	inline void CloseLogger(LogType type, mqhandle handle) noexcept {
-		if (type == LogType::FILE) {
-			api::CloseHandle(handle);
-		}
-	}
+		static void close(mqhandle) noexcept { }
 
-	inline void LoggerLog(LogType type, LogTag tag, mqhandle handle, mqcstr msg, mqui32 size) noexcept {
-		switch (type) {
-		case LogType::STD_CONSOLE: {
+		static void write(LogTag tag, mqhandle handle, mqcstr msg, mqui32 size) noexcept {
 			switch (tag) {
 			case LogTag::INFO: {
 				api::SetConsoleTextAttribute(handle, 0x0002U);
@@ -144,42 +173,766 @@ namespace MasterQian::details {
 			}
 			api::WriteConsoleW(handle, msg, size, nullptr, nullptr);
 			api::SetConsoleTextAttribute(handle, 0x0004U | 0x0002U | 0x0001U);
-			break;
-		}
-		case LogType::FILE: {
-			auto len{ api::WideCharToMultiByte(65001U, 0, msg, size, nullptr, 0, nullptr, nullptr) };
-			if (len > 0) {
-				static std::string buffer;
-				if (buffer.capacity() < len) {
-					buffer.reserve(len);
+		}
+
+		static void write(mqhandle handle, std::string const& buf) noexcept {
+			api::WriteFile(handle, buf.data(), static_cast<mqui32>(buf.size()), nullptr, nullptr);
+		}
+	};
+
+	// Դ
+	template<>
+	struct LogSink<LogType::DEBUG_CONSOLE> {
+		static constexpr bool utf8{ false };
+
+		static mqhandle open(mqcmem) noexcept {
+			return reinterpret_cast<mqhandle>(5201314U);
+		}
+
+		static void close(mqhandle) noexcept { }
+
+		static void write(LogTag, mqhandle, mqcstr msg, mqui32) noexcept {
+			api::OutputDebugStringW(msg);
+		}
+
+		// UTF-8¼OutputDebugStringAᰴANSIҳͣתΪUTF-16
+		static void write(mqhandle, std::string const& buf) noexcept {
+			thread_local std::wstring wbuf;
+			wbuf.clear();
+			LoggerLogValue(wbuf, std::string_view{ buf });
+			api::OutputDebugStringW(wbuf.c_str());
+		}
+	};
+
+	// ļǴ
+	template<>
+	struct LogSink<LogType::FILE> {
+		static constexpr bool utf8{ true };
+		static constexpr std::string_view NewLine{ "\r\n" };
+
+		static mqhandle open(mqcmem arg) noexcept {
+			if (arg) {
+				auto hFile{ api::CreateFileW(static_cast<mqcstr>(arg), 0x40000000U, 0,
+					nullptr, 2U, 0x00000080U, nullptr) };
+				return hFile != reinterpret_cast<mqhandle>(-1) ? hFile : nullptr;
+			}
+			return nullptr;
+		}
+
+		static void close(mqhandle handle) noexcept {
+			api::CloseHandle(handle);
+		}
+
+		static void write(mqhandle handle, std::string const& buf) noexcept {
+			api::WriteFile(handle, buf.data(), static_cast<mqui32>(buf.size()), nullptr, nullptr);
+		}
+	};
+
+	// ׷ļFILE_APPEND_DATA򿪣ÿдԭӵ׷ӵļβ̹
+	template<>
+	struct LogSink<LogType::APPEND_FILE> : LogSink<LogType::FILE> {
+		static mqhandle open(mqcmem arg) noexcept {
+			if (arg) {
+				auto hFile{ api::CreateFileW(static_cast<mqcstr>(arg), 0x00000004U, 0x00000001U | 0x00000002U,
+					nullptr, 4U, 0x00000080U, nullptr) };
+				return hFile != reinterpret_cast<mqhandle>(-1) ? hFile : nullptr;
+			}
+			return nullptr;
+		}
+	};
+
+	// ANSĮתɫɫıͬһдɱܵCI־
+	template<>
+	struct LogSink<LogType::ANSI_CONSOLE> {
+		static constexpr bool utf8{ true };
+		static constexpr std::string_view NewLine{ "\n" };
+		static constexpr std::string_view Color[] = { "\x1b[32m", "\x1b[34m", "\x1b[31m" };
+		static constexpr std::string_view Reset{ "\x1b[0m" };
+
+		static mqhandle open(mqcmem) noexcept {
+			auto handle{ api::GetStdHandle(static_cast<mqui32>(-11)) };
+			if (mqui32 mode{ }; api::GetConsoleMode(handle, &mode)) {
+				api::SetConsoleMode(handle, mode | 0x0004U); // ENABLE_VIRTUAL_TERMINAL_PROCESSING
+			}
+			return handle;
+		}
+
+		static void close(mqhandle) noexcept { }
+
+		static void write(mqhandle handle, std::string const& buf) noexcept {
+			api::WriteFile(handle, buf.data(), static_cast<mqui32>(buf.size()), nullptr, nullptr);
+		}
+	};
+
+	/*    ڴӳ价α־    */
+
+	// ־ļͷcapacityֽڵ
+	struct RingLogHeader {
+		mqui32 magic;
+		mqui32 version;
+		mqui64 capacity; // С2
+		mqui64 head; // ѷֽ
+		mqui64 reserved[5];
+	};
+
+	// ¼ͷposreleaseдΪύǣȡʱݴжϼ¼ͬ
+	struct RingLogRecordHeader {
+		mqui64 pos; // ¼ʼľλ
+		mqui64 time; // ʱ
+		mqui32 size; // ıֽ
+		mqui32 reserved;
+	};
+
+	constexpr mqui32 RingLogMagic{ 0x4C52514DU }; // MQRL
+	constexpr mqui32 RingLogVersion{ 1U };
+	constexpr mqui64 RingLogDefaultCapacity{ 4ULL * 1024ULL * 1024ULL };
+
+	struct RingLogState {
+		mqhandle file;
+		mqhandle mapping;
+		mqbytes view;
+	};
+
+	// ƫд룬Խĩβʱ
+	inline void RingLogCopyIn(mqbytes data, mqui64 capacity, mqui64 pos, mqcmem src, mqui64 size) noexcept {
+		auto offset{ pos & (capacity - 1ULL) };
+		auto first{ capacity - offset < size ? capacity - offset : size };
+		freestanding::copy(data + offset, src, first);
+		if (first < size) {
+			freestanding::copy(data, static_cast<mqcbytes>(src) + first, size - first);
+		}
+	}
+
+	// ƫƶ
+	inline void RingLogCopyOut(mqcbytes data, mqui64 capacity, mqui64 pos, mqmem des, mqui64 size) noexcept {
+		auto offset{ pos & (capacity - 1ULL) };
+		auto first{ capacity - offset < size ? capacity - offset : size };
+		freestanding::copy(des, data + offset, first);
+		if (first < size) {
+			freestanding::copy(static_cast<mqbytes>(des) + first, data, size - first);
+		}
+	}
+
+	// ļдΪһԭӼӷڴ濽ϵͳã̱ϵͳдļ
+	template<>
+	struct LogSink<LogType::RING_FILE> {
+		static constexpr bool utf8{ true };
+		static constexpr std::string_view NewLine{ "\n" };
+
+		static mqhandle open(mqcmem arg) noexcept {
+			if (!arg) return nullptr;
+			auto hFile{ api::CreateFileW(static_cast<mqcstr>(arg), 0x80000000U | 0x40000000U, 0x00000001U,
+				nullptr, 4U, 0x00000080U, nullptr) };
+			if (hFile == reinterpret_cast<mqhandle>(-1)) return nullptr;
+			// ѴڵЧ־дλ
+			mqui64 capacity{ RingLogDefaultCapacity };
+			bool reuse{ };
+			if (mqi64 fileSize{ }; api::GetFileSizeEx(hFile, &fileSize) && fileSize >= static_cast<mqi64>(sizeof(RingLogHeader))) {
+				RingLogHeader header{ };
+				if (api::ReadFile(hFile, &header, sizeof(header), nullptr, nullptr) && header.magic == RingLogMagic &&
+					header.version == RingLogVersion && header.capacity && (header.capacity & (header.capacity - 1ULL)) == 0ULL &&
+					static_cast<mqui64>(fileSize) == sizeof(RingLogHeader) + header.capacity) {
+					capacity = header.capacity;
+					reuse = true;
 				}
-				api::WideCharToMultiByte(65001U, 0, msg, size, buffer.data(), len, nullptr, nullptr);
-				api::WriteFile(handle, buffer.data(), len, nullptr, nullptr);
 			}
-			break;
+			auto totalSize{ sizeof(RingLogHeader) + capacity };
+			auto hMapping{ api::CreateFileMappingW(hFile, nullptr, 0x04U, freestanding::high32(totalSize),
+				freestanding::low32(totalSize), nullptr) };
+			if (!hMapping) {
+				api::CloseHandle(hFile);
+				return nullptr;
+			}
+			auto view{ static_cast<mqbytes>(api::MapViewOfFile(hMapping, 0x0002U | 0x0004U, 0U, 0U, totalSize)) };
+			if (!view) {
+				api::CloseHandle(hMapping);
+				api::CloseHandle(hFile);
+				return nullptr;
+			}
+			if (!reuse) {
+				auto header{ reinterpret_cast<RingLogHeader*>(view) };
+				freestanding::initialize(view, 0, totalSize);
+				header->version = RingLogVersion;
+				header->capacity = capacity;
+				header->head = 0ULL;
+				std::atomic_ref<mqui32>{ header->magic }.store(RingLogMagic, std::memory_order_release);
+			}
+			return new RingLogState{ hFile, hMapping, view };
 		}
-		case LogType::DEBUG_CONSOLE: {
-			api::OutputDebugStringW(msg);
-			break;
+
+		static void close(mqhandle handle) noexcept {
+			auto state{ static_cast<RingLogState*>(handle) };
+			api::UnmapViewOfFile(state->view);
+			api::CloseHandle(state->mapping);
+			api::CloseHandle(state->file);
+			delete state;
+		}
+
+		static void write(mqhandle handle, std::string const& buf) noexcept {
+			auto state{ static_cast<RingLogState*>(handle) };
+			auto header{ reinterpret_cast<RingLogHeader*>(state->view) };
+			auto data{ state->view + sizeof(RingLogHeader) };
+			auto capacity{ header->capacity };
+			auto size{ buf.size() };
+			if (size > (capacity >> 1ULL)) { // ¼һ
+				size = capacity >> 1ULL;
+			}
+			auto total{ (sizeof(RingLogRecordHeader) + size + 7ULL) & ~7ULL };
+			auto pos{ std::atomic_ref<mqui64>{ header->head }.fetch_add(total, std::memory_order_relaxed) };
+			RingLogRecordHeader record{ static_cast<mqui64>(-1), Timestamp{ }, static_cast<mqui32>(size), 0U };
+			RingLogCopyIn(data, capacity, pos, &record, sizeof(record));
+			RingLogCopyIn(data, capacity, pos + sizeof(record), buf.data(), size);
+			// pos8ֽڶ룬ύǲԽĩβ
+			std::atomic_ref<mqui64>{ *reinterpret_cast<mqui64*>(data + (pos & (capacity - 1ULL))) }
+				.store(pos, std::memory_order_release);
 		}
+	};
+
+	/*    ṹ־    */
+
+	// ׷UTF-16ַUTF-8룬escapeΪʱšбַת
+	template<bool escape>
+	inline void Utf8Append(std::string& buf, std::wstring_view sv) noexcept {
+		auto pos{ buf.size() };
+		buf.resize(pos + sv.size() * 6ULL); // : ַתΪ\u00XX
+		auto p{ reinterpret_cast<mqbytes>(buf.data() + pos) };
+		for (mqui64 i{ }, size{ sv.size() }; i < size; ++i) {
+			mqui32 c{ static_cast<mqui16>(sv[i]) };
+			if (c < 0x80U) {
+				if constexpr (escape) {
+					if (c < 0x20U || c == L'"' || c == L'\\') {
+						*p++ = '\\';
+						switch (c) {
+						case L'"': *p++ = '"'; break;
+						case L'\\': *p++ = '\\'; break;
+						case L'\n': *p++ = 'n'; break;
+						case L'\r': *p++ = 'r'; break;
+						case L'\t': *p++ = 't'; break;
+						default: {
+							constexpr mqchara hex[]{ "0123456789abcdef" };
+							*p++ = 'u'; *p++ = '0'; *p++ = '0';
+							*p++ = hex[c >> 4U]; *p++ = hex[c & 0xFU];
+						}
+						}
+						continue;
+					}
+				}
+				*p++ = static_cast<mqbyte>(c);
+			}
+			else if (c < 0x800U) {
+				*p++ = static_cast<mqbyte>(0xC0U | (c >> 6U));
+				*p++ = static_cast<mqbyte>(0x80U | (c & 0x3FU));
+			}
+			else {
+				if (c >= 0xD800U && c <= 0xDFFFU) { // 
+					mqui32 low{ i + 1ULL < size ? static_cast<mqui16>(sv[i + 1ULL]) : 0U };
+					if (c <= 0xDBFFU && low >= 0xDC00U && low <= 0xDFFFU) {
+						c = 0x10000U + ((c - 0xD800U) << 10U) + (low - 0xDC00U);
+						*p++ = static_cast<mqbyte>(0xF0U | (c >> 18U));
+						*p++ = static_cast<mqbyte>(0x80U | ((c >> 12U) & 0x3FU));
+						*p++ = static_cast<mqbyte>(0x80U | ((c >> 6U) & 0x3FU));
+						*p++ = static_cast<mqbyte>(0x80U | (c & 0x3FU));
+						++i;
+						continue;
+					}
+					c = 0xFFFDU; // 滻ΪU+FFFD
+				}
+				*p++ = static_cast<mqbyte>(0xE0U | (c >> 12U));
+				*p++ = static_cast<mqbyte>(0x80U | ((c >> 6U) & 0x3FU));
+				*p++ = static_cast<mqbyte>(0x80U | (c & 0x3FU));
+			}
+		}
+		buf.resize(reinterpret_cast<mqstra>(p) - buf.data());
+	}
+
+	// ׷UTF-8ַescapeΪʱšбַת
+	template<bool escape>
+	inline void Utf8Append(std::string& buf, std::string_view sv) noexcept {
+		if constexpr (escape) {
+			for (auto ch : sv) {
+				auto c{ static_cast<mqbyte>(ch) };
+				if (c < 0x20U || c == '"' || c == '\\') {
+					buf.push_back('\\');
+					switch (c) {
+					case '"': buf.push_back('"'); break;
+					case '\\': buf.push_back('\\'); break;
+					case '\n': buf.push_back('n'); break;
+					case '\r': buf.push_back('r'); break;
+					case '\t': buf.push_back('t'); break;
+					default: {
+						constexpr mqchara hex[]{ "0123456789abcdef" };
+						mqchara u[]{ 'u', '0', '0', hex[c >> 4U], hex[c & 0xFU] };
+						buf.append(u, sizeof(u));
+					}
+					}
+				}
+				else {
+					buf.push_back(ch);
+				}
+			}
+		}
+		else {
+			buf += sv;
+		}
+	}
+
+	// logfmtֵǷҪ
+	template<typename Char>
+	[[nodiscard]] inline bool LogfmtNeedQuote(std::basic_string_view<Char> sv) noexcept {
+		if (sv.empty()) return true;
+		for (auto ch : sv) {
+			if (static_cast<mqui32>(ch) <= 0x20U || ch == Char('=') || ch == Char('"') || ch == Char('\\')) return true;
+		}
+		return false;
+	}
+
+	// ׷
+	template<freestanding::numeric T>
+	inline void LogNumberAppend(std::string& buf, T t) noexcept {
+		mqchara str[32ULL];
+		auto [end, ec] { std::to_chars(str, str + sizeof(str), t) };
+		buf.append(str, end);
+	}
+
+	/*    UTF-8־ߣļ־ֱӸʽUTF-8    */
+
+	// ֲstd::to_wstringһ
+	template<can_to_wstring T>
+	inline void LoggerLogValue(std::string& buf, T&& t) {
+		using U = freestanding::remove_cvref<T>;
+		if constexpr (freestanding::floating_point<U>) {
+			mqchara str[512ULL]; // %fʽdouble309λ
+			auto [end, ec] { std::to_chars(str, str + sizeof(str), t, std::chars_format::fixed, 6) };
+			buf.append(str, end);
+		}
+		else if constexpr (freestanding::signed_integral<U>) {
+			LogNumberAppend(buf, static_cast<mqi64>(t));
+		}
+		else {
+			LogNumberAppend(buf, static_cast<mqui64>(t));
+		}
+	}
+
+	// UTF-16͵ת
+	inline void LoggerLogValue(std::string& buf, std::wstring_view sv) {
+		Utf8Append<false>(buf, sv);
+	}
+
+	// UTF-8ֱ׷
+	inline void LoggerLogValue(std::string& buf, std::string_view sv) {
+		buf += sv;
+	}
+
+	inline void LoggerLogValue(std::string& buf, std::u8string_view sv) {
+		buf.append(reinterpret_cast<mqcstra>(sv.data()), sv.size());
+	}
+
+	template<typename T>
+	concept log_utf8_userstruct_func = requires (std::string & buf, freestanding::remove_cvref<T> const t) {
+		{ Log(buf, t) } noexcept -> freestanding::same<void>;
+	};
+
+	template<typename T>
+	concept log_utf8_userstruct_member_func = requires (std::string & buf, freestanding::remove_cvref<T> const t) {
+		{ t.Log(buf) } noexcept -> freestanding::same<void>;
+	};
+
+	template<typename T>
+	concept log_wstring_view = requires (T const& t) {
+		std::wstring_view(t);
+	};
+
+	template<typename T>
+	concept log_string_view = requires (T const& t) {
+		std::string_view(t);
+	};
+
+	template<typename T>
+	concept log_u8string_view = requires (T const& t) {
+		std::u8string_view(t);
+	};
+
+	// ԶͲʹUTF-8ӿڣ˵ַӿת
+	template<typename T>
+	requires (log_utf8_userstruct_func<T> || log_utf8_userstruct_member_func<T> ||
+		log_userstruct_func<T> || log_userstruct_member_func<T>)
+	inline void LoggerLogValue(std::string& buf, T const& t) {
+		if constexpr (log_utf8_userstruct_func<T>) {
+			Log(buf, t);
+		}
+		else if constexpr (log_utf8_userstruct_member_func<T>) {
+			t.Log(buf);
+		}
+		else {
+			thread_local std::wstring scratch;
+			scratch.clear();
+			LoggerLogValue(scratch, t);
+			Utf8Append<false>(buf, std::wstring_view{ scratch });
+		}
+	}
+
+	// ׷ֵַJSONǼţlogfmtڱҪʱ
+	template<LogFormat format, typename Char>
+	inline void StructuredStringAppend(std::string& buf, std::basic_string_view<Char> sv) noexcept {
+		bool quote{ format == LogFormat::JSON || LogfmtNeedQuote(sv) };
+		if (quote) buf.push_back('"');
+		if constexpr (sizeof(Char) == sizeof(mqchar)) {
+			if (quote) Utf8Append<true>(buf, std::wstring_view{ reinterpret_cast<mqcstr>(sv.data()), sv.size() });
+			else Utf8Append<false>(buf, std::wstring_view{ reinterpret_cast<mqcstr>(sv.data()), sv.size() });
+		}
+		else {
+			if (quote) Utf8Append<true>(buf, std::string_view{ reinterpret_cast<mqcstra>(sv.data()), sv.size() });
+			else Utf8Append<false>(buf, std::string_view{ reinterpret_cast<mqcstra>(sv.data()), sv.size() });
+		}
+		if (quote) buf.push_back('"');
+	}
+
+	/// <summary>
+	/// <para>ṹ־ֵ룬ֱдUTF-8</para>
+	/// <para>Զʹ void Log(std::string&amp; buf, T const&amp;) noexcept Ա void Log(std::string&amp; buf) const noexcept дUTF-8ı</para>
+	/// <para>˵ַ Log(std::wstring&amp;, T) ӿڣתΪUTF-8</para>
+	/// </summary>
+	template<LogFormat format, typename T>
+	inline void StructuredValueAppend(std::string& buf, T const& t) noexcept {
+		using U = freestanding::remove_cvref<T>;
+		if constexpr (freestanding::same<U, bool>) {
+			buf += t ? "true" : "false";
+		}
+		else if constexpr (freestanding::numeric<U> && !freestanding::character<U>) {
+			if constexpr (freestanding::floating_point<U>) {
+				if (t != t || t - t != t - t) { // NaNJSONвǺϷ
+					StructuredStringAppend<format>(buf, std::string_view{ t != t ? "nan" : (t > 0 ? "inf" : "-inf") });
+					return;
+				}
+			}
+			LogNumberAppend(buf, t);
+		}
+		else if constexpr (log_wstring_view<U>) {
+			StructuredStringAppend<format>(buf, std::wstring_view(t));
+		}
+		else if constexpr (log_string_view<U>) {
+			StructuredStringAppend<format>(buf, std::string_view(t));
+		}
+		else if constexpr (log_u8string_view<U>) {
+			StructuredStringAppend<format>(buf, std::u8string_view(t));
+		}
+		else if constexpr (log_utf8_userstruct_func<U> || log_utf8_userstruct_member_func<U> ||
+			log_userstruct_func<U> || log_userstruct_member_func<U>) {
+			thread_local std::string scratch;
+			scratch.clear();
+			LoggerLogValue(scratch, t);
+			StructuredStringAppend<format>(buf, std::string_view{ scratch });
+		}
+		else {
+			static_assert(freestanding::same<U, void>, "MasterQian.Log: unsupported structured log value type");
+		}
+	}
+
+	// ׷Ӽ
+	template<LogFormat format>
+	inline void StructuredKeyAppend(std::string& buf, std::string_view key, bool first) noexcept {
+		if constexpr (format == LogFormat::JSON) {
+			if (!first) buf.push_back(',');
+			buf.push_back('"');
+			Utf8Append<true>(buf, key);
+			buf += "\":";
+		}
+		else {
+			if (!first) buf.push_back(' ');
+			buf += key;
+			buf.push_back('=');
+		}
+	}
+
+	constexpr std::string_view LogTagStringA[] = { "[Info] ", "[Warning] ", "[Error] " };
+
+	// ʽһUTF-8־
+	template<LogType type, LogTag tag, bool newLine, typename... Args>
+	inline void LoggerFormat(std::string& buf, Args&&... args) noexcept {
+		if constexpr (type == LogType::ANSI_CONSOLE) {
+			buf += LogSink<type>::Color[static_cast<mqui32>(tag)];
+		}
+		buf += LogTagStringA[static_cast<mqui32>(tag)];
+		freestanding::rangefor_constexpr([&buf](auto&& arg) {
+			LoggerLogValue(buf, freestanding::forward<decltype(arg)>(arg));
+			}, freestanding::forward<Args>(args)...);
+		if constexpr (type == LogType::ANSI_CONSOLE) {
+			buf += LogSink<type>::Reset;
+		}
+		if constexpr (newLine) {
+			buf += LogSink<type>::NewLine;
 		}
 	}
 }
 
 export namespace MasterQian {
+	/// <summary>
+	/// <para>ʱǰ׺ΪlogĲʱ2024-01-23 22:38:49.012ıʱ</para>
+	/// <para>ͬһڵ־õǰ߳Ѹʽʱ룬ֱд־</para>
+	/// <example>
+	/// <code>
+	/// console.i(LogTime{ }, L" started");
+	/// </code>
+	/// </example>
+	/// </summary>
+	struct LogTime {
+		Timestamp time{ };
+		mqui32 digits{ 3U }; // Сλ0367
+
+		template<typename Char>
+		void append(std::basic_string<Char>& buf) const noexcept {
+			auto pos{ buf.size() };
+			buf.resize(pos + TimeFormatCache<Char>::FormatSize);
+			auto end{ ThreadTimeFormatCache<Char>().format(buf.data() + pos, time, digits) };
+			buf.resize(static_cast<mqui64>(end - buf.data()));
+		}
+
+		void Log(std::wstring& buf) const noexcept {
+			append(buf);
+		}
+
+		void Log(std::string& buf) const noexcept {
+			append(buf);
+		}
+	};
+
+	/*    õԣΪlogģʹ    */
+
+	namespace details {
+		// õ㣬бƵ־ʱҵ־Ĵ
+		struct LogLimitSite {
+			mqui64(*suppressed)() noexcept;
+			LogTag tag;
+			LogLimitSite* next;
+			std::atomic<bool> linked;
+		};
+
+		template<typename Limit, LogTag tag>
+		inline LogLimitSite LogLimitSiteOf{ &Limit::suppressed, tag, nullptr, { } };
+
+		// ʱѹ룬ڻflushʱȡ
+		struct LogLimitList {
+			static constexpr mqui64 ReportInterval{ 10000000ULL }; // ܼ1룬λΪʱ100
+
+			std::atomic<LogLimitSite*> head{ };
+			std::atomic<mqui64> reportAt{ }; // ɿձΪǿպĻʱ
+
+			void push(LogLimitSite& site) noexcept {
+				if (site.linked.load(std::memory_order_relaxed) || site.linked.exchange(true, std::memory_order_acquire)) {
+					return;
+				}
+				auto next{ head.load(std::memory_order_relaxed) };
+				do {
+					site.next = next;
+				} while (!head.compare_exchange_weak(next, &site, std::memory_order_release, std::memory_order_relaxed));
+				if (!next) {
+					reportAt.store(mqui64{ Timestamp{ } } + ReportInterval, std::memory_order_relaxed);
+				}
+			}
+
+			// ÿ־飬ǿҵʱȡƵĵõҲܰ
+			template<typename Func>
+			void report(Func&& func) noexcept {
+				if (!head.load(std::memory_order_relaxed)) return;
+				mqui64 now{ Timestamp{ } };
+				auto at{ reportAt.load(std::memory_order_relaxed) };
+				if (now < at || !reportAt.compare_exchange_strong(at, now + ReportInterval, std::memory_order_relaxed)) return;
+				drain(freestanding::forward<Func>(func));
+			}
+
+			template<typename Func>
+			void drain(Func&& func) noexcept {
+				for (auto site{ head.exchange(nullptr, std::memory_order_acquire) }; site; ) {
+					auto next{ site->next };
+					site->linked.store(false, std::memory_order_release); // ժ£֮ƻ¹
+					if (auto count{ site->suppressed() }) {
+						func(site->tag, count);
+					}
+					site = next;
+				}
+			}
+
+			void swap(LogLimitList& list) noexcept {
+				head.store(list.head.exchange(head.load(std::memory_order_relaxed), std::memory_order_acq_rel), std::memory_order_relaxed);
+				reportAt.store(list.reportAt.exchange(reportAt.load(std::memory_order_relaxed), std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+		};
+	}
+
+	// 
+	struct LogUnlimited {
+		[[nodiscard]] static constexpr bool allow() noexcept {
+			return true;
+		}
+
+		[[nodiscard]] static constexpr mqui64 suppressed() noexcept {
+			return 0ULL;
+		}
+	};
+
+	/// <summary>
+	/// <para>ͰÿrateͻburstGCRA㷨ʵ֣ÿõֻһԭӱ</para>
+	/// <para>SiteǵõıǩͣSite֣ģʵо͵͵ıǩڵĿ</para>
+	/// <para>ദʱռͬһǩ</para>
+	/// <example>
+	/// <code>
+	/// console.e&lt;true, LogRateLimit&lt;struct DbTimeout, 10ULL, 20ULL&gt;&gt;(L"db timeout ", code);
+	/// </code>
+	/// </example>
+	/// </summary>
+	template<typename Site, mqui64 rate, mqui64 burst = rate>
+	requires (rate > 0ULL && burst > 0ULL)
+	struct LogRateLimit {
+	private:
+		static constexpr mqui64 Interval{ 10000000ULL / rate }; // λΪʱ100
+		static constexpr mqui64 Tolerance{ Interval * burst };
+
+		static inline std::atomic<mqui64> tat{ }; // ۵ʱ
+		static inline std::atomic<mqui64> dropped{ };
+	public:
+		[[nodiscard]] static bool allow() noexcept {
+			mqui64 now{ Timestamp{ } };
+			auto t{ tat.load(std::memory_order_relaxed) };
+			for (;;) {
+				auto next{ (t > now ? t : now) + Interval };
+				if (next - now > Tolerance) {
+					dropped.fetch_add(1ULL, std::memory_order_relaxed);
+					return false;
+				}
+				if (tat.compare_exchange_weak(t, next, std::memory_order_relaxed)) {
+					return true;
+				}
+			}
+		}
+
+		/// <summary>
+		/// ȡ㱻Ƶ
+		/// </summary>
+		[[nodiscard]] static mqui64 suppressed() noexcept {
+			return dropped.load(std::memory_order_relaxed) ? dropped.exchange(0ULL, std::memory_order_relaxed) : 0ULL;
+		}
+	};
+
+	/// <summary>
+	/// <para>ÿrate1δͬ</para>
+	/// <para>Siteǵõıǩͣ÷ͬLogRateLimit</para>
+	/// </summary>
+	template<typename Site, mqui64 rate>
+	requires (rate > 0ULL)
+	struct LogSample {
+	private:
+		static inline std::atomic<mqui64> counter{ };
+		static inline std::atomic<mqui64> dropped{ };
+	public:
+		[[nodiscard]] static bool allow() noexcept {
+			if (counter.fetch_add(1ULL, std::memory_order_relaxed) % rate == 0ULL) {
+				return true;
+			}
+			dropped.fetch_add(1ULL, std::memory_order_relaxed);
+			return false;
+		}
+
+		/// <summary>
+		/// ȡ㱻Ƶ
+		/// </summary>
+		[[nodiscard]] static mqui64 suppressed() noexcept {
+			return dropped.load(std::memory_order_relaxed) ? dropped.exchange(0ULL, std::memory_order_relaxed) : 0ULL;
+		}
+	};
+
+	/// <summary>
+	/// <para>־־ۻڻflushʱһд</para>
+	/// <para>UTF-8ˣܱȴ־</para>
+	/// </summary>
+	template<LogType type>
+	struct LogBatch {
+	private:
+		mqhandle handle;
+		std::string buf;
+
+		static constexpr mqui64 FlushSize{ 64ULL * 1024ULL };
+	public:
+		explicit LogBatch(mqhandle h) noexcept : handle{ h } {
+			buf.reserve(FlushSize);
+		}
+
+		LogBatch(LogBatch const&) = delete;
+		LogBatch& operator = (LogBatch const&) = delete;
+
+		~LogBatch() noexcept {
+			flush();
+		}
+
+		/// <summary>
+		/// дۻ־
+		/// </summary>
+		void flush() noexcept {
+			if (handle && !buf.empty()) {
+				details::LogSink<type>::write(handle, buf);
+			}
+			buf.clear();
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <typeparam name="tag">־ǩ</typeparam>
+		/// <typeparam name="newLine">Զ</typeparam>
+		template<LogTag tag = LogTag::INFO, bool newLine = true, typename... Args>
+		void log(Args&&... args) noexcept {
+			details::LoggerFormat<type, tag, newLine>(buf, freestanding::forward<Args>(args)...);
+			if (buf.size() >= FlushSize) {
+				flush();
+			}
+		}
+
+		/// <summary>
+		/// Ϣ
+		/// </summary>
+		template<bool newLine = true, typename... Args>
+		void i(Args&&... args) noexcept {
+			log<LogTag::INFO, newLine>(freestanding::forward<Args>(args)...);
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		template<bool newLine = true, typename... Args>
+		void w(Args&&... args) noexcept {
+			log<LogTag::WARNING, newLine>(freestanding::forward<Args>(args)...);
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		template<bool newLine = true, typename... Args>
+		void e(Args&&... args) noexcept {
+			log<LogTag::ERR, newLine>(freestanding::forward<Args>(args)...);
+		}
+	};
+
 	template<LogType type>
 	struct Logger {
 	private:
 		mqhandle handle;
+		mutable details::LogLimitList limited; // δõ
 
 		static constexpr mqcstr LogTagString[] = { L"[Info] ", L"[Warning] ", L"[Error] " };
+
+		void _suppressed(LogTag tag, mqui64 count) const noexcept {
+			switch (tag) {
+			case LogTag::INFO: log<LogTag::INFO>(L"suppressed ", count, L" messages"); break;
+			case LogTag::WARNING: log<LogTag::WARNING>(L"suppressed ", count, L" messages"); break;
+			default: log<LogTag::ERR>(L"suppressed ", count, L" messages"); break;
+			}
+		}
 	public:
 		/// <summary>
 		/// ļ־ҪļΪҪ
 		/// </summary>
 		/// <param name="arg"></param>
 		Logger(mqcmem arg = nullptr) noexcept {
-			handle = details::CreateLogger(type, arg);
+			handle = details::LogSink<type>::open(arg);
 		}
 
 		Logger(Logger const&) = delete;
@@ -187,11 +940,13 @@ export namespace MasterQian {
 
 		Logger(Logger&& logger) noexcept : handle{ } {
 			freestanding::swap(handle, logger.handle);
+			limited.swap(logger.limited);
 		}
 
 		Logger& operator = (Logger&& logger) noexcept {
 			if (this != &logger) {
 				freestanding::swap(handle, logger.handle);
+				limited.swap(logger.limited);
 			}
 			return *this;
 		}
@@ -206,60 +961,96 @@ export namespace MasterQian {
 		/// <param name="arg"></param>
 		void reset(mqcmem arg = nullptr) noexcept {
 			close();
-			handle = details::CreateLogger(type, arg);
+			handle = details::LogSink<type>::open(arg);
+		}
+
+		/// <summary>
+		/// õδıرʱԶãʱ־Ҳÿһ
+		/// </summary>
+		void flush() const noexcept {
+			limited.drain([this](LogTag tag, mqui64 count) noexcept {
+				_suppressed(tag, count);
+			});
 		}
 
 		/// <summary>
 		/// ر
 		/// </summary>
 		void close() noexcept {
+			flush();
 			if (handle) {
-				details::CloseLogger(type, handle);
+				details::LogSink<type>::close(handle);
 				handle = nullptr;
 			}
 		}
 
+		/// <summary>
+		/// ־־ϲΪһд
+		/// </summary>
+		[[nodiscard]] LogBatch<type> batch() const noexcept requires (details::LogSink<type>::utf8) {
+			return LogBatch<type>{ handle };
+		}
+
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <typeparam name="tag">־ǩ</typeparam>
 		/// <typeparam name="newLine">Զ</typeparam>
-		template<LogTag tag = LogTag::INFO, bool newLine = true, typename... Args>
+		/// <typeparam name="Limit">ԣƵڸõõһе־ǰÿĶڻܻflushʱ</typeparam>
+		template<LogTag tag = LogTag::INFO, bool newLine = true, typename Limit = LogUnlimited, typename... Args>
 		void log(Args&&... args) const noexcept {
 			if (handle) {
-				std::wstring buf{ LogTagString[static_cast<mqui32>(tag)] };
-				freestanding::rangefor_constexpr([&buf](auto&& arg) {
-					details::LoggerLogValue(buf, freestanding::forward<decltype(arg)>(arg));
-					}, freestanding::forward<Args>(args)...);
-				if (newLine) {
-					buf += (type == LogType::FILE ? L"\r\n" : L"\n");
+				limited.report([this](LogTag level, mqui64 count) noexcept {
+					_suppressed(level, count);
+				});
+				if (!Limit::allow()) {
+					limited.push(details::LogLimitSiteOf<Limit, tag>);
+					return;
+				}
+				if (auto count{ Limit::suppressed() }) {
+					log<tag, true>(L"suppressed ", count, L" messages");
+				}
+				if constexpr (details::LogSink<type>::utf8) { // ֱӸʽΪUTF-8һд
+					thread_local std::string buf;
+					buf.clear();
+					details::LoggerFormat<type, tag, newLine>(buf, freestanding::forward<Args>(args)...);
+					details::LogSink<type>::write(handle, buf);
+				}
+				else {
+					std::wstring buf{ LogTagString[static_cast<mqui32>(tag)] };
+					freestanding::rangefor_constexpr([&buf](auto&& arg) {
+						details::LoggerLogValue(buf, freestanding::forward<decltype(arg)>(arg));
+						}, freestanding::forward<Args>(args)...);
+					if (newLine) {
+						buf += L"\n";
+					}
+					details::LogSink<type>::write(tag, handle, buf.data(), static_cast<mqui32>(buf.size()));
 				}
-				details::LoggerLog(type, tag, handle, buf.data(), static_cast<mqui32>(buf.size()));
 			}
 		}
 
 		/// <summary>
 		/// Ϣ
 		/// </summary>
-		template<bool newLine = true, typename... Args>
+		template<bool newLine = true, typename Limit = LogUnlimited, typename... Args>
 		void i(Args&&... args) const noexcept {
-			log<LogTag::INFO, newLine>(freestanding::forward<Args>(args)...);
+			log<LogTag::INFO, newLine, Limit>(freestanding::forward<Args>(args)...);
 		}
 
 		/// <summary>
 		/// 
 		/// </summary>
-		template<bool newLine = true, typename... Args>
+		template<bool newLine = true, typename Limit = LogUnlimited, typename... Args>
 		void w(Args&&... args) const noexcept {
-			log<LogTag::WARNING, newLine>(freestanding::forward<Args>(args)...);
+			log<LogTag::WARNING, newLine, Limit>(freestanding::forward<Args>(args)...);
 		}
 
 		/// <summary>
 		/// 
 		/// </summary>
-		template<bool newLine = true, typename... Args>
+		template<bool newLine = true, typename Limit = LogUnlimited, typename... Args>
 		void e(Args&&... args) const noexcept {
-			log<LogTag::ERR, newLine>(freestanding::forward<Args>(args)...);
+			log<LogTag::ERR, newLine, Limit>(freestanding::forward<Args>(args)...);
 		}
 	};
 
@@ -271,6 +1062,218 @@ export namespace MasterQian {
 
 	// ļ־ָļ
 	using FileLogger = Logger<LogType::FILE>;
+
+	// ׷ļ־ָļ׷
+	using AppendFileLogger = Logger<LogType::APPEND_FILE>;
+
+	// ANSĮ־תɫ
+	using AnsiConsoleLogger = Logger<LogType::ANSI_CONSOLE>;
+
+	// α־ָļ쳣˳Ա־
+	using RingFileLogger = Logger<LogType::RING_FILE>;
+
+	// ־¼
+	struct RingLogRecord {
+		Timestamp time;
+		std::string text;
+	};
+
+	/// <summary>
+	/// д˳ԭ־е¼δύѱǵļ¼ᱻ
+	/// </summary>
+	/// <param name="data">־ļ</param>
+	/// <param name="size">ļС</param>
+	/// <returns>¼бɾɵ</returns>
+	[[nodiscard]] inline mqlist<RingLogRecord> ReadRingLog(mqcbytes data, mqui64 size) noexcept {
+		mqlist<RingLogRecord> records;
+		using Header = details::RingLogHeader;
+		using RecordHeader = details::RingLogRecordHeader;
+		if (size < sizeof(Header)) return records;
+		Header header{ };
+		freestanding::copy(&header, data, sizeof(Header));
+		auto capacity{ header.capacity };
+		if (header.magic != details::RingLogMagic || header.version != details::RingLogVersion || !capacity ||
+			(capacity & (capacity - 1ULL)) != 0ULL || size < sizeof(Header) + capacity) {
+			return records;
+		}
+		auto ring{ data + sizeof(Header) };
+		auto head{ header.head };
+		for (mqui64 pos{ head > capacity ? head - capacity : 0ULL }; pos + sizeof(RecordHeader) <= head; ) {
+			RecordHeader record{ };
+			details::RingLogCopyOut(ring, capacity, pos, &record, sizeof(RecordHeader));
+			if (record.pos != pos || record.size > (capacity >> 1ULL)) { // Ǽ¼ʼ8ֽͬ
+				pos += 8ULL;
+				continue;
+			}
+			auto total{ (sizeof(RecordHeader) + record.size + 7ULL) & ~7ULL };
+			if (pos + total > head) break;
+			std::string text(record.size, '\0');
+			details::RingLogCopyOut(ring, capacity, pos + sizeof(RecordHeader), text.data(), record.size);
+			records.add(Timestamp{ record.time }, freestanding::move(text));
+			pos += total;
+		}
+		return records;
+	}
+
+	// ṹ־ֶ
+	template<typename T>
+	struct LogField {
+		std::string_view key;
+		T const& value;
+	};
+
+	template<typename T>
+	LogField(std::string_view, T const&) -> LogField<T>;
+
+	/// <summary>
+	/// <para>ṹ־ÿ¼ΪһJSONlogfmtʱǩ߳IDϢֶ</para>
+	/// <para>¼ֱӱ߳ڸõUTF-8ȶٷڴ</para>
+	/// <example>
+	/// <code>
+	/// StructuredLogger&lt;LogType::FILE&gt; logger{ L"app.jsonl" };
+	/// logger.i(L"login", LogField{ "user", name }, LogField{ "elapsed", 12.5 });
+	/// // {"ts":17060207290123456,"level":"info","tid":1234,"msg":"login","user":"qian","elapsed":12.5}
+	/// </code>
+	/// </example>
+	/// </summary>
+	template<LogType type, LogFormat format = LogFormat::JSON>
+	struct StructuredLogger {
+	private:
+		mqhandle handle;
+		mutable details::LogLimitList limited; // δõ
+
+		static constexpr std::string_view LogTagString[] = { "info", "warning", "error" };
+
+		void _suppressed(LogTag tag, mqui64 count) const noexcept {
+			switch (tag) {
+			case LogTag::INFO: log<LogTag::INFO>("suppressed messages", LogField{ "suppressed", count }); break;
+			case LogTag::WARNING: log<LogTag::WARNING>("suppressed messages", LogField{ "suppressed", count }); break;
+			default: log<LogTag::ERR>("suppressed messages", LogField{ "suppressed", count }); break;
+			}
+		}
+	public:
+		/// <summary>
+		/// ļ־ҪļΪҪ
+		/// </summary>
+		/// <param name="arg"></param>
+		StructuredLogger(mqcmem arg = nullptr) noexcept {
+			handle = details::LogSink<type>::open(arg);
+		}
+
+		StructuredLogger(StructuredLogger const&) = delete;
+		StructuredLogger& operator = (StructuredLogger const&) = delete;
+
+		StructuredLogger(StructuredLogger&& logger) noexcept : handle{ } {
+			freestanding::swap(handle, logger.handle);
+			limited.swap(logger.limited);
+		}
+
+		StructuredLogger& operator = (StructuredLogger&& logger) noexcept {
+			if (this != &logger) {
+				freestanding::swap(handle, logger.handle);
+				limited.swap(logger.limited);
+			}
+			return *this;
+		}
+
+		~StructuredLogger() noexcept {
+			close();
+		}
+
+		/// <summary>
+		/// ض
+		/// </summary>
+		/// <param name="arg"></param>
+		void reset(mqcmem arg = nullptr) noexcept {
+			close();
+			handle = details::LogSink<type>::open(arg);
+		}
+
+		/// <summary>
+		/// õδıرʱԶãʱ־Ҳÿһ
+		/// </summary>
+		void flush() const noexcept {
+			limited.drain([this](LogTag tag, mqui64 count) noexcept {
+				_suppressed(tag, count);
+			});
+		}
+
+		/// <summary>
+		/// ر
+		/// </summary>
+		void close() noexcept {
+			flush();
+			if (handle) {
+				details::LogSink<type>::close(handle);
+				handle = nullptr;
+			}
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="msg">Ϣ</param>
+		/// <param name="fields">ֶ</param>
+		/// <typeparam name="tag">־ǩ</typeparam>
+		/// <typeparam name="Limit">ԣƵڸõõһеļ¼ǰÿĶڻܻflushʱ</typeparam>
+		template<LogTag tag = LogTag::INFO, typename Limit = LogUnlimited, typename Msg, typename... Fields>
+		void log(Msg const& msg, LogField<Fields>... fields) const noexcept {
+			if (handle) {
+				limited.report([this](LogTag level, mqui64 count) noexcept {
+					_suppressed(level, count);
+				});
+				if (!Limit::allow()) {
+					limited.push(details::LogLimitSiteOf<Limit, tag>);
+					return;
+				}
+				if (auto count{ Limit::suppressed() }) {
+					log<tag>("suppressed messages", LogField{ "suppressed", count });
+				}
+				thread_local std::string buf;
+				buf.clear();
+				if constexpr (format == LogFormat::JSON) buf.push_back('{');
+				details::StructuredKeyAppend<format>(buf, "ts", true);
+				details::LogNumberAppend(buf, Timestamp{ }.stamp());
+				details::StructuredKeyAppend<format>(buf, "level", false);
+				details::StructuredStringAppend<format>(buf, LogTagString[static_cast<mqui32>(tag)]);
+				details::StructuredKeyAppend<format>(buf, "tid", false);
+				details::LogNumberAppend(buf, api::GetCurrentThreadId());
+				details::StructuredKeyAppend<format>(buf, "msg", false);
+				details::StructuredValueAppend<format>(buf, msg);
+				freestanding::rangefor_constexpr([ ](auto const& field) {
+					details::StructuredKeyAppend<format>(buf, field.key, false);
+					details::StructuredValueAppend<format>(buf, field.value);
+					}, fields...);
+				if constexpr (format == LogFormat::JSON) buf.push_back('}');
+				buf.push_back('\n');
+				details::LogSink<type>::write(handle, buf);
+			}
+		}
+
+		/// <summary>
+		/// Ϣ
+		/// </summary>
+		template<typename Limit = LogUnlimited, typename Msg, typename... Fields>
+		void i(Msg const& msg, LogField<Fields>... fields) const noexcept {
+			log<LogTag::INFO, Limit>(msg, fields...);
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		template<typename Limit = LogUnlimited, typename Msg, typename... Fields>
+		void w(Msg const& msg, LogField<Fields>... fields) const noexcept {
+			log<LogTag::WARNING, Limit>(msg, fields...);
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		template<typename Limit = LogUnlimited, typename Msg, typename... Fields>
+		void e(Msg const& msg, LogField<Fields>... fields) const noexcept {
+			log<LogTag::ERR, Limit>(msg, fields...);
+		}
+	};
 }
 
 
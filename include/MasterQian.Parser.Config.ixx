@@ -2,10 +2,39 @@ module;
 #include "MasterQian.Meta.h"
 #include <string>
 #include <unordered_map>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <algorithm>
 #define MasterQianModuleVersion 20240131ULL
 
 export module MasterQian.Parser.Config;
 export import MasterQian.Bin;
+import MasterQian.Data;
+
+namespace MasterQian::api {
+	META_WINAPI(mqbool, CloseHandle, mqhandle);
+	META_WINAPI(mqhandle, CreateFileW, mqcstr, mqui32, mqui32, mqhandle, mqui32, mqui32, mqhandle);
+	META_WINAPI(mqbool, ReadFile, mqhandle, mqmem, mqui32, mqui32*, mqhandle);
+	META_WINAPI(mqbool, WriteFile, mqhandle, mqcmem, mqui32, mqui32*, mqhandle);
+	META_WINAPI(mqbool, GetFileSizeEx, mqhandle, mqi64*);
+	META_WINAPI(mqbool, SetFilePointerEx, mqhandle, mqi64, mqi64*, mqui32);
+	META_WINAPI(mqbool, SetEndOfFile, mqhandle);
+	META_WINAPI(mqbool, FlushFileBuffers, mqhandle);
+	META_WINAPI(mqbool, MoveFileExW, mqcstr, mqcstr, mqui32);
+	META_WINAPI(mqui32, GetLastError);
+}
+
+#pragma comment(linker,"/alternatename:__imp_?CloseHandle@api@MasterQian@@YAHPEAX@Z::<!MasterQian.Parser.Config>=__imp_CloseHandle")
+#pragma comment(linker,"/alternatename:__imp_?CreateFileW@api@MasterQian@@YAPEAXPEB_WIIPEAXII1@Z::<!MasterQian.Parser.Config>=__imp_CreateFileW")
+#pragma comment(linker,"/alternatename:__imp_?ReadFile@api@MasterQian@@YAHPEAX0IPEAI0@Z::<!MasterQian.Parser.Config>=__imp_ReadFile")
+#pragma comment(linker,"/alternatename:__imp_?WriteFile@api@MasterQian@@YAHPEAXPEBXIPEAI0@Z::<!MasterQian.Parser.Config>=__imp_WriteFile")
+#pragma comment(linker,"/alternatename:__imp_?GetFileSizeEx@api@MasterQian@@YAHPEAXPEA_J@Z::<!MasterQian.Parser.Config>=__imp_GetFileSizeEx")
+#pragma comment(linker,"/alternatename:__imp_?SetFilePointerEx@api@MasterQian@@YAHPEAX_JPEA_JI@Z::<!MasterQian.Parser.Config>=__imp_SetFilePointerEx")
+#pragma comment(linker,"/alternatename:__imp_?SetEndOfFile@api@MasterQian@@YAHPEAX@Z::<!MasterQian.Parser.Config>=__imp_SetEndOfFile")
+#pragma comment(linker,"/alternatename:__imp_?FlushFileBuffers@api@MasterQian@@YAHPEAX@Z::<!MasterQian.Parser.Config>=__imp_FlushFileBuffers")
+#pragma comment(linker,"/alternatename:__imp_?MoveFileExW@api@MasterQian@@YAHPEB_W0I@Z::<!MasterQian.Parser.Config>=__imp_MoveFileExW")
+#pragma comment(linker,"/alternatename:__imp_?GetLastError@api@MasterQian@@YAIXZ::<!MasterQian.Parser.Config>=__imp_GetLastError")
 
 namespace MasterQian::Parser {
 	namespace details {
@@ -67,6 +96,533 @@ namespace MasterQian::Parser {
 			}
 			return data;
 		}
+
+		// 汾2ļͷ
+		struct ConfigHeader {
+			mqui32 magic;
+			mqui16 version;
+			mqui16 flags;
+			mqui64 count;
+			mqui64 blockCount;
+			mqui64 blockOffset; // ƫ
+			mqui64 indexOffset; // ƫ
+			mqui32 blockCrc; // Уֵ
+			mqui32 indexCrc; // Уֵ
+			mqui32 reserved;
+			mqui32 headerCrc; // ļͷֶУֵ
+		};
+
+		// ݿ飬Ŀ
+		struct ConfigBlock {
+			mqui64 offset;
+			mqui64 size;
+			mqui32 crc;
+			mqui32 reserved;
+		};
+
+		// ϣ
+		struct ConfigIndex {
+			mqui64 hash;
+			mqui64 offset; // Ŀƫ
+		};
+
+		static_assert(sizeof(ConfigHeader) == 56ULL && sizeof(ConfigBlock) == 24ULL && sizeof(ConfigIndex) == 16ULL);
+
+		inline constexpr mqui32 ConfigMagic{ 0x4643514DU }; // "MQCF"
+		inline constexpr mqui16 ConfigVersion{ 2U };
+		inline constexpr mqui64 ConfigBlockSize{ 64ULL * 1024ULL };
+
+		// Ҫضȡṹ
+		template<typename T>
+		inline T ConfigLoad(mqcbytes data) noexcept {
+			T t;
+			freestanding::copy(&t, data, sizeof(T));
+			return t;
+		}
+
+		inline mqui64 ConfigHash(std::wstring_view key) noexcept {
+			return freestanding::hash_bytes(reinterpret_cast<mqcbytes>(key.data()), key.size() * sizeof(mqchar));
+		}
+
+		inline mqui32 ConfigHeaderCrc(ConfigHeader const& header) noexcept {
+			return Data::CRC32({ reinterpret_cast<mqcbytes>(&header), sizeof(ConfigHeader) - sizeof(mqui32) });
+		}
+
+		inline bool ConfigIsV2(BinView bv) noexcept {
+			return bv.size() >= sizeof(ConfigHeader) && ConfigLoad<mqui32>(bv.data()) == ConfigMagic;
+		}
+
+		// УļͷԽ磬ͨдheader
+		inline bool ConfigCheckHeader(BinView bv, ConfigHeader& header) noexcept {
+			if (!ConfigIsV2(bv)) return false;
+			auto tmp{ ConfigLoad<ConfigHeader>(bv.data()) };
+			if (tmp.version != ConfigVersion || tmp.headerCrc != ConfigHeaderCrc(tmp)) return false;
+			auto size{ bv.size() };
+			if (tmp.blockOffset > size || tmp.blockCount > (size - tmp.blockOffset) / sizeof(ConfigBlock)) return false;
+			if (tmp.indexOffset > size || tmp.count > (size - tmp.indexOffset) / sizeof(ConfigIndex)) return false;
+			if (tmp.blockCrc != Data::CRC32({ bv.data() + tmp.blockOffset, tmp.blockCount * sizeof(ConfigBlock) })) return false;
+			header = tmp;
+			return true;
+		}
+
+		// Уݿ鲢䲻Խ
+		inline bool ConfigCheckBlock(BinView bv, ConfigBlock const& block) noexcept {
+			return block.offset >= sizeof(ConfigHeader) && block.offset <= bv.size() && block.size <= bv.size() - block.offset
+				&& block.crc == Data::CRC32({ bv.data() + block.offset, block.size });
+		}
+
+		// [data, end)ڵһĿԽ緵nullptr
+		inline mqcbytes ConfigParseEntry(mqcbytes data, mqcbytes end, std::wstring_view& key, BinView& value) noexcept {
+			mqui64 keySize{ }, valueSize{ };
+			if (static_cast<mqui64>(end - data) < sizeof(mqui64)) return nullptr;
+			data = ReadImpl(data, keySize);
+			if (keySize > static_cast<mqui64>(end - data) || keySize % sizeof(mqchar)) return nullptr;
+			key = { reinterpret_cast<mqcstr>(data), keySize / sizeof(mqchar) };
+			data += keySize;
+			if (static_cast<mqui64>(end - data) < sizeof(mqui64)) return nullptr;
+			data = ReadImpl(data, valueSize);
+			if (valueSize > static_cast<mqui64>(end - data)) return nullptr;
+			value = { data, valueSize };
+			return data + valueSize;
+		}
+	}
+
+	/// <summary>
+	/// ֽڼʽ
+	/// </summary>
+	export enum class ConfigFormat : mqenum {
+		V1, // Ŀ볤ǰ׺ļֵ
+		V2, // ļͷֿCRC32У밴ϣļֱڴӳңռ56ֽļͷÿ16ֽ
+		Compact, // 4ֽڱʶ䳤ĿͻĿУԴ˸ʽ
+	};
+
+	/// <summary>
+	/// ֵ
+	/// </summary>
+	export enum class ConfigType : mqbyte {
+		Raw, // ɸʽֵ
+		Int, // зzigzag䳤
+		UInt, // ޷䳤
+		F32, // ȸС
+		F64, // ˫ȸС
+		String, // UTF-8ַ
+		Bytes, // ֽڼ
+		Config, // 
+		Array, // ͬ
+		None = 0xFU, // ò
+	};
+
+	/// <summary>
+	/// úϲ
+	/// </summary>
+	export enum class ConfigMerge : mqenum {
+		Override, // ԴøѴڵ
+		Keep, // Ѵڵ
+		Deep, // ˫Ϊʱݹϲ򸲸
+	};
+
+	export struct ConfigView;
+	export struct ConfigPatch;
+	export struct ConfigJournal;
+
+	namespace details {
+		inline constexpr mqui16 ConfigFlagTyped{ 1U }; // ֵֽΪͱǣĿΪ䳤
+		inline constexpr mqui16 ConfigFlagUtf8Key{ 2U }; // UTF-8棬ϣ԰UTF-16
+		inline constexpr mqui32 ConfigCompactMagic{ 0x4243514DU }; // "MQCB"
+
+		// ͱǣ4λΪͣ4λΪԭȵĶɸʽʱԭ
+		inline constexpr mqbyte ConfigTag(ConfigType type, mqui64 size = 1ULL) noexcept {
+			mqbyte width{ };
+			while ((1ULL << width) < size) ++width;
+			return static_cast<mqbyte>(static_cast<mqbyte>(type) | (width << 4U));
+		}
+
+		inline constexpr ConfigType ConfigTagType(mqbyte tag) noexcept {
+			return static_cast<ConfigType>(tag & 0xFU);
+		}
+
+		inline constexpr mqui64 ConfigTagWidth(mqbyte tag) noexcept {
+			return 1ULL << (tag >> 4U);
+		}
+
+		inline constexpr mqui64 VarintSize(mqui64 value) noexcept {
+			mqui64 size{ 1ULL };
+			for (; value >= 0x80ULL; value >>= 7ULL) ++size;
+			return size;
+		}
+
+		template<freestanding::numeric T>
+		inline constexpr ConfigType ConfigNumberType{ freestanding::floating_point<T> ? (sizeof(T) == sizeof(mqf32) ? ConfigType::F32 : ConfigType::F64)
+			: freestanding::signed_integral<T> ? ConfigType::Int : ConfigType::UInt };
+
+		inline mqbytes VarintWrite(mqbytes data, mqui64 value) noexcept {
+			for (; value >= 0x80ULL; value >>= 7ULL) {
+				*data++ = static_cast<mqbyte>(value | 0x80ULL);
+			}
+			*data++ = static_cast<mqbyte>(value);
+			return data;
+		}
+
+		// ȡ䳤ضϻ򳬳nullptr
+		inline mqcbytes VarintRead(mqcbytes data, mqcbytes end, mqui64& value) noexcept {
+			value = 0ULL;
+			for (mqui64 shift{ }; data != end && shift < 64ULL; shift += 7ULL) {
+				auto byte{ *data++ };
+				value |= static_cast<mqui64>(byte & 0x7FU) << shift;
+				if (!(byte & 0x80U)) return data;
+			}
+			return nullptr;
+		}
+
+		inline mqbytes FixedWrite(mqbytes data, mqui64 value, mqui64 size) noexcept {
+			for (mqui64 i{ }; i < size; ++i) {
+				*data++ = static_cast<mqbyte>(value >> (i * 8ULL));
+			}
+			return data;
+		}
+
+		inline mqui64 FixedRead(mqcbytes data, mqui64 size) noexcept {
+			mqui64 value{ };
+			for (mqui64 i{ }; i < size; ++i) {
+				value |= static_cast<mqui64>(data[i]) << (i * 8ULL);
+			}
+			return value;
+		}
+
+		// ͻʽļUTF-8棬Ĵ3ֽڱ(WTF-8)UTF-16ת
+		inline mqui64 ConfigKeySize(std::wstring_view key) noexcept {
+			mqui64 size{ };
+			for (mqui64 i{ }; i < key.size(); ++i) {
+				auto c{ static_cast<mqui32>(key[i]) };
+				if (c < 0x80U) size += 1ULL;
+				else if (c < 0x800U) size += 2ULL;
+				else if (c >= 0xD800U && c < 0xDC00U && i + 1ULL < key.size() && key[i + 1ULL] >= 0xDC00U && key[i + 1ULL] < 0xE000U) {
+					size += 4ULL;
+					++i;
+				}
+				else size += 3ULL;
+			}
+			return size;
+		}
+
+		inline mqbytes ConfigKeyWrite(mqbytes data, std::wstring_view key) noexcept {
+			for (mqui64 i{ }; i < key.size(); ++i) {
+				auto c{ static_cast<mqui32>(key[i]) };
+				if (c < 0x80U) {
+					*data++ = static_cast<mqbyte>(c);
+				}
+				else if (c < 0x800U) {
+					*data++ = static_cast<mqbyte>(0xC0U | (c >> 6U));
+					*data++ = static_cast<mqbyte>(0x80U | (c & 0x3FU));
+				}
+				else if (c >= 0xD800U && c < 0xDC00U && i + 1ULL < key.size() && key[i + 1ULL] >= 0xDC00U && key[i + 1ULL] < 0xE000U) {
+					c = 0x10000U + ((c - 0xD800U) << 10U) + (static_cast<mqui32>(key[++i]) - 0xDC00U);
+					*data++ = static_cast<mqbyte>(0xF0U | (c >> 18U));
+					*data++ = static_cast<mqbyte>(0x80U | ((c >> 12U) & 0x3FU));
+					*data++ = static_cast<mqbyte>(0x80U | ((c >> 6U) & 0x3FU));
+					*data++ = static_cast<mqbyte>(0x80U | (c & 0x3FU));
+				}
+				else {
+					*data++ = static_cast<mqbyte>(0xE0U | (c >> 12U));
+					*data++ = static_cast<mqbyte>(0x80U | ((c >> 6U) & 0x3FU));
+					*data++ = static_cast<mqbyte>(0x80U | (c & 0x3FU));
+				}
+			}
+			return data;
+		}
+
+		// ȡһ㣬Ƿضϵı뷵nullptr
+		inline mqcbytes ConfigKeyNext(mqcbytes data, mqcbytes end, mqui32& cp) noexcept {
+			mqui32 lead{ *data++ };
+			if (lead < 0x80U) {
+				cp = lead;
+				return data;
+			}
+			mqui64 extra{ lead >= 0xF0U ? 3ULL : lead >= 0xE0U ? 2ULL : 1ULL };
+			if (lead < 0xC2U || lead > 0xF4U || static_cast<mqui64>(end - data) < extra) return nullptr;
+			cp = lead & (0x3FU >> extra);
+			for (mqui64 i{ }; i < extra; ++i) {
+				if ((data[i] & 0xC0U) != 0x80U) return nullptr;
+				cp = (cp << 6U) | (data[i] & 0x3FU);
+			}
+			if ((extra == 2ULL && cp < 0x800U) || (extra == 3ULL && (cp < 0x10000U || cp > 0x10FFFFU))) return nullptr;
+			return data + extra;
+		}
+
+		// UTF-8outbytes.size()ַַǷ뷵~0ULL
+		inline mqui64 ConfigKeyRead(BinView bytes, mqchar* out) noexcept {
+			mqchar* begin{ out };
+			for (mqcbytes p{ bytes.data() }, end{ p + bytes.size() }; p != end; ) {
+				mqui32 cp;
+				if (!(p = ConfigKeyNext(p, end, cp))) return ~0ULL;
+				if (cp >= 0x10000U) {
+					*out++ = static_cast<mqchar>(0xD800U + ((cp - 0x10000U) >> 10U));
+					*out++ = static_cast<mqchar>(0xDC00U + ((cp - 0x10000U) & 0x3FFU));
+				}
+				else *out++ = static_cast<mqchar>(cp);
+			}
+			return static_cast<mqui64>(out - begin);
+		}
+
+		inline bool ConfigKeyString(BinView bytes, std::wstring& key) noexcept {
+			key.resize(bytes.size());
+			auto size{ ConfigKeyRead(bytes, key.data()) };
+			if (size == ~0ULL) return false;
+			key.resize(size);
+			return true;
+		}
+
+		// ȽUTF-8UTF-16룬ڴ
+		inline bool ConfigKeyEqual(BinView bytes, std::wstring_view key) noexcept {
+			mqui64 i{ };
+			for (mqcbytes p{ bytes.data() }, end{ p + bytes.size() }; p != end; ) {
+				mqui32 cp;
+				if (!(p = ConfigKeyNext(p, end, cp))) return false;
+				if (cp >= 0x10000U) {
+					if (key.size() - i < 2ULL || key[i] != static_cast<mqchar>(0xD800U + ((cp - 0x10000U) >> 10U))
+						|| key[i + 1ULL] != static_cast<mqchar>(0xDC00U + ((cp - 0x10000U) & 0x3FFU))) return false;
+					i += 2ULL;
+				}
+				else if (i == key.size() || key[i++] != static_cast<mqchar>(cp)) return false;
+			}
+			return i == key.size();
+		}
+
+		// ͻʽĿԱ䳤¼ֵֽΪUTF-8
+		inline mqui64 ConfigCompactSize(std::wstring_view key, BinView value) noexcept {
+			auto keySize{ ConfigKeySize(key) };
+			return VarintSize(keySize) + keySize + VarintSize(value.size()) + value.size();
+		}
+
+		inline mqbytes ConfigCompactWrite(mqbytes data, std::wstring_view key, BinView value) noexcept {
+			data = ConfigKeyWrite(VarintWrite(data, ConfigKeySize(key)), key);
+			data = VarintWrite(data, value.size());
+			freestanding::copy(data, value.data(), value.size());
+			return data + value.size();
+		}
+
+		// [data, end)ڵһͻĿΪԭʼֽڣԽ緵nullptr
+		inline mqcbytes ConfigParseEntry(mqcbytes data, mqcbytes end, BinView& key, BinView& value) noexcept {
+			mqui64 keySize{ }, valueSize{ };
+			if (!(data = VarintRead(data, end, keySize)) || keySize > static_cast<mqui64>(end - data)) return nullptr;
+			key = { data, keySize };
+			data += keySize;
+			if (!(data = VarintRead(data, end, valueSize)) || valueSize > static_cast<mqui64>(end - data)) return nullptr;
+			value = { data, valueSize };
+			return data + valueSize;
+		}
+
+		// [data, end)ڼΪUTF-16ĿcompactΪڰ汾2ͻʽԽ緵nullptr
+		inline mqcbytes ConfigParseEntry(mqcbytes data, mqcbytes end, std::wstring_view& key, BinView& value, bool compact) noexcept {
+			if (!compact) return ConfigParseEntry(data, end, key, value);
+			BinView bytes;
+			if (!(data = ConfigParseEntry(data, end, bytes, value)) || bytes.size() % sizeof(mqchar)) return nullptr;
+			key = { reinterpret_cast<mqcstr>(bytes.data()), bytes.size() / sizeof(mqchar) };
+			return data;
+		}
+
+		inline bool ConfigIsCompact(BinView bv) noexcept {
+			return bv.size() >= sizeof(mqui32) && ConfigLoad<mqui32>(bv.data()) == ConfigCompactMagic;
+		}
+
+		// ֣ͱǣ10ֽ
+		template<freestanding::numeric T>
+		inline mqbytes ConfigEncodeNumber(mqbytes data, T value) noexcept {
+			if constexpr (sizeof(T) == sizeof(mqf32) && freestanding::floating_point<T>) {
+				mqui32 bits;
+				freestanding::copy(&bits, &value, sizeof(bits));
+				return FixedWrite(data, bits, sizeof(bits));
+			}
+			else if constexpr (freestanding::floating_point<T>) {
+				auto number{ static_cast<mqf64>(value) };
+				mqui64 bits;
+				freestanding::copy(&bits, &number, sizeof(bits));
+				return FixedWrite(data, bits, sizeof(bits));
+			}
+			else if constexpr (freestanding::signed_integral<T>) {
+				auto number{ static_cast<mqi64>(value) };
+				return VarintWrite(data, (static_cast<mqui64>(number) << 1ULL) ^ static_cast<mqui64>(number >> 63LL));
+			}
+			else {
+				return VarintWrite(data, static_cast<mqui64>(value));
+			}
+		}
+
+		// ֣ͲݻֵTķΧnullptr
+		template<freestanding::numeric T>
+		inline mqcbytes ConfigDecodeNumber(mqcbytes data, mqcbytes end, ConfigType type, T& value) noexcept {
+			if (type == ConfigType::Int || type == ConfigType::UInt) {
+				if constexpr (freestanding::integral<T>) {
+					mqui64 bits{ };
+					if (!(data = VarintRead(data, end, bits))) return nullptr;
+					if (type == ConfigType::Int) {
+						auto number{ static_cast<mqi64>((bits >> 1ULL) ^ (0ULL - (bits & 1ULL))) };
+						value = static_cast<T>(number);
+						return static_cast<mqi64>(value) == number && (number < 0LL) == (value < T{ }) ? data : nullptr;
+					}
+					value = static_cast<T>(bits);
+					return static_cast<mqui64>(value) == bits && !(value < T{ }) ? data : nullptr;
+				}
+			}
+			else if (type == ConfigType::F32 || type == ConfigType::F64) {
+				if constexpr (freestanding::floating_point<T>) {
+					auto size{ type == ConfigType::F32 ? sizeof(mqf32) : sizeof(mqf64) };
+					if (static_cast<mqui64>(end - data) < size) return nullptr;
+					auto bits{ FixedRead(data, size) };
+					if (type == ConfigType::F32) {
+						auto bits32{ static_cast<mqui32>(bits) };
+						mqf32 number;
+						freestanding::copy(&number, &bits32, sizeof(number));
+						value = static_cast<T>(number);
+					}
+					else {
+						mqf64 number;
+						freestanding::copy(&number, &bits, sizeof(number));
+						value = static_cast<T>(number);
+					}
+					return data + size;
+				}
+			}
+			return nullptr;
+		}
+
+		// ִ洢ֵΪݣ͸ʽֵΪRaw
+		inline ConfigType ConfigSplit(BinView stored, bool typed, BinView& body) noexcept {
+			if (!typed || stored.size() == 0ULL) {
+				body = stored;
+				return ConfigType::Raw;
+			}
+			body = { stored.data() + 1ULL, stored.size() - 1ULL };
+			return ConfigTagType(*stored.data());
+		}
+
+		inline Bin ConfigValue(mqbyte tag, BinView body) noexcept {
+			Bin value(body.size() + 1ULL);
+			value.data()[0] = tag;
+			freestanding::copy(value.data() + 1ULL, body.data(), body.size());
+			return value;
+		}
+
+		template<freestanding::numeric T>
+		inline Bin ConfigValue(T value) noexcept {
+			mqbyte buf[16];
+			buf[0] = ConfigTag(ConfigNumberType<T>, sizeof(T));
+			return Bin{ buf, static_cast<mqui64>(ConfigEncodeNumber(buf + 1, value) - buf) };
+		}
+
+		template<freestanding::numeric T>
+		inline bool ConfigNumber(ConfigType type, BinView body, T& value) noexcept {
+			if (type == ConfigType::Raw) {
+				if (body.size() != sizeof(T)) return false;
+				freestanding::copy(&value, body.data(), sizeof(T));
+				return true;
+			}
+			auto end{ body.data() + body.size() };
+			auto p{ ConfigDecodeNumber(body.data(), end, type, value) };
+			return p && p == end;
+		}
+
+		inline std::wstring ConfigString(ConfigType type, BinView body) noexcept {
+			if (type == ConfigType::String) return ToString(body, CodePage::UTF8);
+			return { reinterpret_cast<mqcstr>(body.data()), body.size() / sizeof(mqchar) };
+		}
+
+		// ΪԪرǡ䳤αԪأַԪش䳤ǰ׺
+		template<typename T>
+		inline Bin ConfigArray(T const* data, mqui64 count) noexcept {
+			mqui64 capacity{ 12ULL };
+			mqlist<Bin> texts;
+			if constexpr (freestanding::numeric<T>) {
+				capacity += count * 10ULL;
+			}
+			else {
+				texts.reserve(count);
+				for (mqui64 i{ }; i < count; ++i) {
+					capacity += texts.add(ToBin(data[i], CodePage::UTF8)).size() + 10ULL;
+				}
+			}
+			Bin buf(capacity);
+			auto p{ buf.data() };
+			*p++ = ConfigTag(ConfigType::Array);
+			if constexpr (freestanding::numeric<T>) {
+				*p++ = ConfigTag(ConfigNumberType<T>, sizeof(T));
+				p = VarintWrite(p, count);
+				for (mqui64 i{ }; i < count; ++i) {
+					p = ConfigEncodeNumber(p, data[i]);
+				}
+			}
+			else {
+				*p++ = ConfigTag(ConfigType::String);
+				p = VarintWrite(p, count);
+				for (auto& text : texts) {
+					p = VarintWrite(p, text.size());
+					freestanding::copy(p, text.data(), text.size());
+					p += text.size();
+				}
+			}
+			return Bin{ buf.data(), static_cast<mqui64>(p - buf.data()) };
+		}
+
+		template<typename T>
+		inline bool ConfigArray(ConfigType type, BinView body, mqlist<T>& values) noexcept {
+			if (type != ConfigType::Array || body.size() == 0ULL) return false;
+			mqcbytes p{ body.data() + 1ULL }, end{ body.data() + body.size() };
+			auto element{ ConfigTagType(*body.data()) };
+			mqui64 count{ };
+			// ÿԪ1ֽ
+			if (!(p = VarintRead(p, end, count)) || count > static_cast<mqui64>(end - p)) return false;
+			values.reserve(count);
+			for (mqui64 i{ }; i < count; ++i) {
+				if constexpr (freestanding::numeric<T>) {
+					if (!(p = ConfigDecodeNumber(p, end, element, values.add()))) return false;
+				}
+				else {
+					mqui64 size{ };
+					if (element != ConfigType::String || !(p = VarintRead(p, end, size)) || size > static_cast<mqui64>(end - p)) return false;
+					values.add(ToString({ p, size }, CodePage::UTF8));
+					p += size;
+				}
+			}
+			return p == end;
+		}
+
+		// ļдεò1GB
+		inline constexpr mqui32 ConfigFileChunk{ 1U << 30U };
+
+		inline bool ConfigReadFile(mqhandle handle, Bin& bin) noexcept {
+			mqi64 size{ };
+			if (!api::GetFileSizeEx(handle, &size)) return false;
+			bin = Bin(static_cast<mqui64>(size));
+			for (mqui64 offset{ }; offset < bin.size(); ) {
+				auto chunk{ bin.size() - offset < ConfigFileChunk ? static_cast<mqui32>(bin.size() - offset) : ConfigFileChunk };
+				mqui32 read{ };
+				if (!api::ReadFile(handle, bin.data() + offset, chunk, &read, nullptr) || read == 0U) return false;
+				offset += read;
+			}
+			return true;
+		}
+
+		inline bool ConfigWriteFile(mqhandle handle, BinView bv) noexcept {
+			for (mqui64 offset{ }; offset < bv.size(); ) {
+				auto chunk{ bv.size() - offset < ConfigFileChunk ? static_cast<mqui32>(bv.size() - offset) : ConfigFileChunk };
+				mqui32 written{ };
+				if (!api::WriteFile(handle, bv.data() + offset, chunk, &written, nullptr) || written == 0U) return false;
+				offset += written;
+			}
+			return true;
+		}
+
+		// д벢ˢµ
+		inline bool ConfigSaveFile(mqcstr path, BinView bv) noexcept {
+			auto hFile{ api::CreateFileW(path, 0x40000000U, 0, nullptr, 2U, 0x00000080U, nullptr) };
+			if (hFile == reinterpret_cast<mqhandle>(-1)) return false;
+			auto ok{ ConfigWriteFile(hFile, bv) && api::FlushFileBuffers(hFile) };
+			api::CloseHandle(hFile);
+			return ok;
+		}
+
+		template<typename T>
+		concept config_element = freestanding::numeric<T> || freestanding::same<T, std::wstring>;
 	}
 	
 	// ö
@@ -75,6 +631,9 @@ namespace MasterQian::Parser {
 		using ConstPointT = mqcbytes;
 		using SizeT = mqui64;
 		using BaseT = std::unordered_map<std::wstring, Bin, freestanding::isomerism_hash, freestanding::isomerism_equal>;
+
+		friend struct ConfigPatch;
+		friend struct ConfigJournal;
 	public:
 		Config() = default;
 
@@ -97,33 +656,19 @@ namespace MasterQian::Parser {
 		/// </summary>
 		/// <param name="key"></param>
 		/// <param name="value">ֵ</param>
-		/// <typeparam name="T">֧ͣ򸡵</typeparam>
+		/// <typeparam name="T">֧ͣ򸡵ͣԱ䳤뱣</typeparam>
 		template<freestanding::numeric T>
 		void set(std::wstring_view key, T value) noexcept {
-			auto data{ reinterpret_cast<ConstPointT>(&value) };
-			auto count{ sizeof(T) };
-			if (auto iter{ find(key) }; iter != cend()) {
-				iter->second = { data, count };
-			}
-			else {
-				try_emplace(std::wstring(key), data, count);
-			}
+			_set(key, details::ConfigValue(value));
 		}
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="key"></param>
-		/// <param name="value">ֵַ</param>
+		/// <param name="value">ֵַUTF-8</param>
 		void set(std::wstring_view key, std::wstring_view value) noexcept {
-			auto data{ reinterpret_cast<ConstPointT>(value.data()) };
-			auto count{ value.size() * sizeof(mqchar) };
-			if (auto iter{ find(key) }; iter != cend()) {
-				iter->second = { data, count };
-			}
-			else {
-				try_emplace(std::wstring(key), data, count);
-			}
+			_set(key, details::ConfigValue(details::ConfigTag(ConfigType::String), ToBin(value, CodePage::UTF8)));
 		}
 
 		/// <summary>
@@ -132,12 +677,7 @@ namespace MasterQian::Parser {
 		/// <param name="key"></param>
 		/// <param name="value">ֽڼֵ</param>
 		void set(std::wstring_view key, BinView value) noexcept {
-			if (auto iter{ find(key) }; iter != cend()) {
-				iter->second = Bin(value);
-			}
-			else {
-				try_emplace(std::wstring(key), value);
-			}
+			_set(key, details::ConfigValue(details::ConfigTag(ConfigType::Bytes), value));
 		}
 
 		/// <summary>
@@ -146,12 +686,28 @@ namespace MasterQian::Parser {
 		/// <param name="key"></param>
 		/// <param name="value"></param>
 		void set(std::wstring_view key, Config const& value) noexcept {
-			if (auto iter{ find(key) }; iter != cend()) {
-				iter->second = value.save();
-			}
-			else {
-				try_emplace(std::wstring(key), value.save());
-			}
+			_set(key, details::ConfigValue(details::ConfigTag(ConfigType::Config), value.save(ConfigFormat::Compact)));
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="values"></param>
+		/// <typeparam name="T">Ԫַ֧ͣ</typeparam>
+		template<details::config_element T>
+		void set(std::wstring_view key, mqlist<T> const& values) noexcept {
+			_set(key, details::ConfigArray(values.data(), values.size()));
+		}
+
+		/// <summary>
+		/// ȡ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <returns>ͣʱNone</returns>
+		[[nodiscard]] ConfigType type(std::wstring_view key) const noexcept {
+			BinView body;
+			return _value(key, body);
 		}
 
 		/// <summary>
@@ -160,15 +716,12 @@ namespace MasterQian::Parser {
 		/// <param name="key"></param>
 		/// <param name="default_value">Ĭֵ</param>
 		/// <typeparam name="T">֧ͣ򸡵</typeparam>
-		/// <returns>ֵ</returns>
+		/// <returns>ֵͲݻ򳬳TķΧʱĬֵ</returns>
 		template<freestanding::numeric T>
 		[[nodiscard]] T get(std::wstring_view key, T default_value = { }) const noexcept {
-			if (auto iter{ find(key) }; iter != cend()) {
-				return *reinterpret_cast<T const*>(iter->second.data());
-			}
-			else {
-				return default_value;
-			}
+			BinView body;
+			T value;
+			return details::ConfigNumber(_value(key, body), body, value) ? value : default_value;
 		}
 
 		/// <summary>
@@ -178,14 +731,11 @@ namespace MasterQian::Parser {
 		/// <param name="default_value">Ĭֵ</param>
 		/// <returns>ֵ</returns>
 		[[nodiscard]] std::wstring get(std::wstring_view key, std::wstring_view default_value = { }) const noexcept {
-			if (auto iter{ find(key) }; iter != cend()) {
-				auto data{ reinterpret_cast<mqcstr>(iter->second.data()) };
-				auto count{ iter->second.size() / sizeof(mqchar) };
-				return { data, data + count };
-			}
-			else {
-				return std::wstring{ default_value };
+			BinView body;
+			if (auto type{ _value(key, body) }; type == ConfigType::String || type == ConfigType::Raw) {
+				return details::ConfigString(type, body);
 			}
+			return std::wstring{ default_value };
 		}
 
 		/// <summary>
@@ -195,12 +745,11 @@ namespace MasterQian::Parser {
 		/// <param name="default_value">Ĭֵ</param>
 		/// <returns>ֵ</returns>
 		[[nodiscard]] Bin get_bin(std::wstring_view key, BinView default_value = { }) const noexcept {
-			if (auto iter{ find(key) }; iter != cend()) {
-				return iter->second;
-			}
-			else {
-				return Bin{ default_value };
+			BinView body;
+			if (auto type{ _value(key, body) }; type == ConfigType::Bytes || type == ConfigType::Raw) {
+				return Bin{ body };
 			}
+			return Bin{ default_value };
 		}
 
 		/// <summary>
@@ -210,11 +759,74 @@ namespace MasterQian::Parser {
 		/// <param name="default_value">Ĭֵ</param>
 		/// <returns>ֵ</returns>
 		[[nodiscard]] Config get_config(std::wstring_view key, Config const& default_value = { }) const noexcept {
-			if (auto iter{ find(key) }; iter != cend()) {
-				return Config(iter->second);
+			BinView body;
+			if (auto type{ _value(key, body) }; type == ConfigType::Config || type == ConfigType::Raw) {
+				return Config(body);
 			}
-			else {
-				return default_value;
+			return default_value;
+		}
+
+		/// <summary>
+		/// ȡ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <typeparam name="T">Ԫַ֧ͣ</typeparam>
+		/// <returns>飬Ͳʱؿ</returns>
+		template<details::config_element T>
+		[[nodiscard]] mqlist<T> get_array(std::wstring_view key) const noexcept {
+			BinView body;
+			mqlist<T> values;
+			if (!details::ConfigArray(_value(key, body), body, values)) {
+				values.clear();
+			}
+			return values;
+		}
+
+		/// <summary>
+		/// ϲ
+		/// </summary>
+		/// <param name="other">Դ</param>
+		/// <param name="policy">ϲ</param>
+		void merge(Config const& other, ConfigMerge policy = ConfigMerge::Override) noexcept {
+			reserve(BaseT::size() + other.size());
+			for (auto& [key, value] : other) {
+				BinView body;
+				_merge(key, details::ConfigSplit(value, true, body), body, policy, [&value] { return Bin(value); });
+			}
+		}
+
+		/// <summary>
+		/// ϲãԴõĽڵֱתƣ·ֵ
+		/// </summary>
+		/// <param name="other">ԴãϲֻʣδתƵ</param>
+		/// <param name="policy">ϲ</param>
+		void merge(Config&& other, ConfigMerge policy = ConfigMerge::Override) noexcept {
+			if (policy == ConfigMerge::Keep) {
+				BaseT::merge(static_cast<BaseT&>(other));
+				return;
+			}
+			reserve(BaseT::size() + other.size());
+			for (auto iter{ other.begin() }; iter != other.end(); ) {
+				auto result{ insert(other.extract(iter++)) };
+				if (!result.inserted) {
+					BinView body;
+					auto& value{ result.node.mapped() };
+					_merge(result.position->first, details::ConfigSplit(value, true, body), body, policy,
+						[&value] { return freestanding::move(value); });
+				}
+			}
+		}
+
+		/// <summary>
+		/// ϲͼֻΪд÷ֵ
+		/// </summary>
+		/// <param name="view">Դͼ</param>
+		/// <param name="policy">ϲ</param>
+		template<typename View> requires freestanding::same<View, ConfigView>
+		void merge(View const& view, ConfigMerge policy = ConfigMerge::Override) noexcept {
+			reserve(BaseT::size() + view.size());
+			for (auto& entry : view) {
+				_merge(entry.key, entry.type, entry.value, policy, [&entry] { return details::ConfigValue(entry.tag, entry.value); });
 			}
 		}
 
@@ -233,38 +845,1043 @@ namespace MasterQian::Parser {
 		}
 
 		/// <summary>
-		/// ֽڼ
+		/// ֽڼ룬ԶʶʽУ鳤Уֵ
 		/// </summary>
 		/// <param name="bv">ֽڼ</param>
-		void load(BinView bv) noexcept {
+		/// <returns>true</returns>
+		bool load(BinView bv) noexcept {
 			clear();
-			ConstPointT p{ bv.data() };
+			if (details::ConfigIsV2(bv)) {
+				return _load_v2(bv);
+			}
+			if (details::ConfigIsCompact(bv)) {
+				return _load_compact(bv);
+			}
+			ConstPointT p{ bv.data() }, end{ bv.data() + bv.size() };
 			SizeT count{ };
+			if (bv.size() < sizeof(SizeT)) return bv.size() == 0ULL;
 			p = details::Read(p, count);
 			for (SizeT i{ }; i < count; ++i) {
-				std::wstring key;
-				Bin value;
-				p = details::Read(p, key, value);
-				try_emplace(freestanding::move(key), freestanding::move(value));
+				std::wstring_view key;
+				BinView value;
+				if (!(p = details::ConfigParseEntry(p, end, key, value))) return false;
+				try_emplace(std::wstring(key), details::ConfigValue(details::ConfigTag(ConfigType::Raw), value));
 			}
+			return true;
 		}
 
 		/// <summary>
 		/// ֽڼ
 		/// </summary>
+		/// <param name="format">ʽ</param>
 		/// <returns>ֽڼ</returns>
-		[[nodiscard]] Bin save() const noexcept {
+		[[nodiscard]] Bin save(ConfigFormat format = ConfigFormat::V2) const noexcept {
+			if (format == ConfigFormat::V2) {
+				return _save_v2();
+			}
+			if (format == ConfigFormat::Compact) {
+				return _save_compact();
+			}
+			mqlist<Bin> values;
+			values.reserve(BaseT::size());
 			SizeT totalCount{ sizeof(SizeT) };
 			for (auto& [key, value] : *this) {
-				totalCount += key.size() * sizeof(mqchar) + value.size() + sizeof(SizeT) * 2ULL;
+				totalCount += key.size() * sizeof(mqchar) + values.add(_legacy(value)).size() + sizeof(SizeT) * 2ULL;
 			}
 			Bin bin(totalCount);
 			auto data{ bin.data() };
 			data = details::Write(data, BaseT::size());
+			SizeT i{ };
  			for (auto& [key, value] : *this) {
-				data = details::Write(data, key, value);
+				data = details::Write(data, key, values[i++]);
+			}
+			return bin;
+		}
+	private:
+		// ϲãmake蹹캬ͱǵĴ洢ֵ
+		template<typename Make>
+		void _merge(std::wstring_view key, ConfigType type, BinView body, ConfigMerge policy, Make&& make) noexcept {
+			auto iter{ find(key) };
+			if (iter == end()) {
+				try_emplace(std::wstring(key), make());
+				return;
+			}
+			if (policy == ConfigMerge::Keep) return;
+			if (BinView current; policy == ConfigMerge::Deep && type == ConfigType::Config
+				&& details::ConfigSplit(iter->second, true, current) == ConfigType::Config) {
+				Config nested(current);
+				nested.merge(Config(body), ConfigMerge::Deep);
+				iter->second = details::ConfigValue(details::ConfigTag(ConfigType::Config), nested.save(ConfigFormat::Compact));
+				return;
+			}
+			iter->second = make();
+		}
+
+		void _set(std::wstring_view key, Bin&& value) noexcept {
+			if (auto iter{ find(key) }; iter != cend()) {
+				iter->second = freestanding::move(value);
+			}
+			else {
+				try_emplace(std::wstring(key), freestanding::move(value));
+			}
+		}
+
+		[[nodiscard]] ConfigType _value(std::wstring_view key, BinView& body) const noexcept {
+			if (auto iter{ find(key) }; iter != cend()) {
+				return details::ConfigSplit(iter->second, true, body);
+			}
+			return ConfigType::None;
+		}
+
+		// תΪɸʽֵԭȻԭַתUTF-16
+		[[nodiscard]] static Bin _legacy(BinView stored) noexcept {
+			BinView body;
+			switch (auto type{ details::ConfigSplit(stored, true, body) }) {
+			case ConfigType::Int:
+			case ConfigType::UInt: {
+				mqui64 bits{ };
+				details::VarintRead(body.data(), body.data() + body.size(), bits);
+				if (type == ConfigType::Int) {
+					bits = (bits >> 1ULL) ^ (0ULL - (bits & 1ULL));
+				}
+				return Bin{ reinterpret_cast<mqcbytes>(&bits), details::ConfigTagWidth(*stored.data()) };
+			}
+			case ConfigType::String: {
+				auto text{ ToString(body, CodePage::UTF8) };
+				return Bin{ reinterpret_cast<mqcbytes>(text.data()), text.size() * sizeof(mqchar) };
+			}
+			case ConfigType::Config:
+				return Config(body).save(ConfigFormat::V1);
+			default:
+				return Bin{ body };
+			}
+		}
+
+		bool _load_v2(BinView bv) noexcept {
+			details::ConfigHeader header;
+			if (!details::ConfigCheckHeader(bv, header)) return false;
+			if (header.indexCrc != Data::CRC32({ bv.data() + header.indexOffset, header.count * sizeof(details::ConfigIndex) })) return false;
+			reserve(header.count);
+			SizeT count{ };
+			bool typed{ (header.flags & details::ConfigFlagTyped) != 0U };
+			bool utf8{ typed && (header.flags & details::ConfigFlagUtf8Key) != 0U };
+			std::wstring name;
+			for (SizeT i{ }; i < header.blockCount; ++i) {
+				auto block{ details::ConfigLoad<details::ConfigBlock>(bv.data() + header.blockOffset + i * sizeof(details::ConfigBlock)) };
+				if (!details::ConfigCheckBlock(bv, block)) return false;
+				for (ConstPointT p{ bv.data() + block.offset }, end{ p + block.size }; p != end; ++count) {
+					std::wstring_view key;
+					BinView value;
+					if (utf8) {
+						BinView bytes;
+						if (!(p = details::ConfigParseEntry(p, end, bytes, value)) || !details::ConfigKeyString(bytes, name)) return false;
+						key = name;
+					}
+					else if (!(p = details::ConfigParseEntry(p, end, key, value, typed))) return false;
+					_emplace(key, value, typed);
+				}
+			}
+			return count == header.count;
+		}
+
+		bool _load_compact(BinView bv) noexcept {
+			ConstPointT p{ bv.data() + sizeof(mqui32) }, end{ bv.data() + bv.size() };
+			SizeT total{ };
+			// ÿĿֽٰ
+			if (!(p = details::VarintRead(p, end, total)) || total > static_cast<SizeT>(end - p) / 2ULL) return false;
+			reserve(total);
+			std::wstring name;
+			for (SizeT i{ }; i < total; ++i) {
+				BinView key, value;
+				if (!(p = details::ConfigParseEntry(p, end, key, value)) || !details::ConfigKeyString(key, name)) return false;
+				_emplace(name, value, true);
+			}
+			return p == end;
+		}
+
+		// Ŀظ׸ͻʽĿֵΪ
+		void _emplace(std::wstring_view key, BinView value, bool typed) noexcept {
+			if (typed && value.size() != 0ULL) {
+				try_emplace(std::wstring(key), value);
+			}
+			else {
+				try_emplace(std::wstring(key), details::ConfigValue(details::ConfigTag(ConfigType::Raw), value));
+			}
+		}
+
+		[[nodiscard]] Bin _save_v2() const noexcept {
+			auto count{ BaseT::size() };
+			mqarray<details::ConfigIndex> index(count);
+			mqlist<details::ConfigBlock> blocks;
+			// Ŀ˳ݿ飬鲻ConfigBlockSizeĿռһ
+			SizeT offset{ sizeof(details::ConfigHeader) }, blockStart{ offset }, i{ };
+			for (auto& [key, value] : *this) {
+				auto entrySize{ details::ConfigCompactSize(key, value) };
+				if (offset != blockStart && offset - blockStart + entrySize > details::ConfigBlockSize) {
+					blocks.add(details::ConfigBlock{ blockStart, offset - blockStart });
+					blockStart = offset;
+				}
+				index[i++] = { details::ConfigHash(key), offset };
+				offset += entrySize;
+			}
+			if (offset != blockStart) {
+				blocks.add(details::ConfigBlock{ blockStart, offset - blockStart });
+			}
+			details::ConfigHeader header{ details::ConfigMagic, details::ConfigVersion };
+			header.flags = details::ConfigFlagTyped | details::ConfigFlagUtf8Key;
+			header.count = count;
+			header.blockCount = blocks.size();
+			header.blockOffset = (offset + 7ULL) & ~7ULL;
+			header.indexOffset = header.blockOffset + blocks.size() * sizeof(details::ConfigBlock);
+			Bin bin(header.indexOffset + count * sizeof(details::ConfigIndex));
+			auto data{ bin.data() + sizeof(details::ConfigHeader) };
+			for (auto& [key, value] : *this) {
+				data = details::ConfigCompactWrite(data, key, value);
+			}
+			for (auto& block : blocks) {
+				block.crc = Data::CRC32({ bin.data() + block.offset, block.size });
+			}
+			std::sort(index.begin(), index.end(), [](details::ConfigIndex const& a, details::ConfigIndex const& b) noexcept {
+				return a.hash != b.hash ? a.hash < b.hash : a.offset < b.offset;
+				});
+			freestanding::copy(bin.data() + header.blockOffset, blocks.data(), blocks.size() * sizeof(details::ConfigBlock));
+			freestanding::copy(bin.data() + header.indexOffset, index.data(), count * sizeof(details::ConfigIndex));
+			header.blockCrc = Data::CRC32({ bin.data() + header.blockOffset, blocks.size() * sizeof(details::ConfigBlock) });
+			header.indexCrc = Data::CRC32({ bin.data() + header.indexOffset, count * sizeof(details::ConfigIndex) });
+			header.headerCrc = details::ConfigHeaderCrc(header);
+			freestanding::copy(bin.data(), &header, sizeof(details::ConfigHeader));
+			return bin;
+		}
+
+		[[nodiscard]] Bin _save_compact() const noexcept {
+			SizeT total{ sizeof(mqui32) + details::VarintSize(BaseT::size()) };
+			for (auto& [key, value] : *this) {
+				total += details::ConfigCompactSize(key, value);
+			}
+			Bin bin(total);
+			auto data{ details::VarintWrite(details::WriteImpl(bin.data(), details::ConfigCompactMagic), BaseT::size()) };
+			for (auto& [key, value] : *this) {
+				data = details::ConfigCompactWrite(data, key, value);
 			}
 			return bin;
 		}
 	};
-}
\ No newline at end of file
+
+	/// <summary>
+	/// <para>ͼ͵ؽConfig::saveֽڼֵԭ</para>
+	/// <para>汾2ʽʱֻУļͷڼ϶֣Ŀڿ״ηʱУ</para>
+	/// <para>ɸʽոʽһνĿϣ״ηʱ</para>
+	/// <para>ͼڼԭ뱣Чʺֱڴӳļ</para>
+	/// </summary>
+	export struct ConfigView {
+		using SizeT = mqui64;
+
+		// Ŀ
+		struct Entry {
+			std::wstring_view key;
+			ConfigType type;
+			mqbyte tag; // ͱǣRawΪ0
+			BinView value; // ͱ
+		};
+	private:
+		using ConstPointT = mqcbytes;
+
+		BinView bin;
+		details::ConfigHeader header{ };
+		bool indexed{ }; // 汾2ʽ
+		bool typed{ }; // ֵͱ
+		bool utf8{ }; // UTF-8
+		SizeT count{ };
+		mutable mqarray<Entry> entries; // 汾2ʽ״αʱ
+		mutable mqarray<mqchar> names; // UTF-8ıĿļô˴
+		mutable std::atomic<bool> listed;
+		mqarray<mqui32> table; // ɸʽոʽĿѰַĿ+10Ϊ
+		mutable mqarray<std::atomic<mqui8>> verified; // У״̬0δУ顢1ͨ2ʧ
+		mutable std::mutex mutex;
+		mutable mqarray<std::atomic<ConfigView*>> children; // û棬ĿŴţ״ȡʱ
+		mutable std::atomic<bool> childrenReady;
+
+		void _release() noexcept {
+			for (auto& child : children) {
+				delete child.load(std::memory_order_relaxed);
+			}
+			children.clear();
+			childrenReady.store(false, std::memory_order_relaxed);
+		}
+
+		bool _fail() noexcept {
+			entries.clear();
+			names.clear();
+			table.clear();
+			count = 0ULL;
+			return false;
+		}
+
+		[[nodiscard]] details::ConfigBlock _block(SizeT index) const noexcept {
+			return details::ConfigLoad<details::ConfigBlock>(bin.data() + header.blockOffset + index * sizeof(details::ConfigBlock));
+		}
+
+		[[nodiscard]] bool _verify_block(SizeT index) const noexcept {
+			auto state{ verified[index].load(std::memory_order_acquire) };
+			if (!state) {
+				state = details::ConfigCheckBlock(bin, _block(index)) ? 1U : 2U;
+				verified[index].store(state, std::memory_order_release);
+			}
+			return state == 1U;
+		}
+
+		// ƫڿ飬ʧܷؿ
+		[[nodiscard]] SizeT _find_block(SizeT offset) const noexcept {
+			SizeT lo{ }, hi{ header.blockCount };
+			while (lo < hi) {
+				auto mid{ lo + (hi - lo) / 2ULL };
+				if (_block(mid).offset <= offset) lo = mid + 1ULL;
+				else hi = mid;
+			}
+			if (lo == 0ULL) return header.blockCount;
+			auto block{ _block(lo - 1ULL) };
+			return offset - block.offset < block.size ? lo - 1ULL : header.blockCount;
+		}
+
+		// ĿidΪĿţû
+		[[nodiscard]] bool _find(std::wstring_view key, BinView& value, SizeT& id) const noexcept {
+			if (!count) return false;
+			auto hash{ details::ConfigHash(key) };
+			if (!indexed) {
+				auto mask{ table.size() - 1ULL };
+				for (auto i{ hash & mask }; auto index{ table[i] }; i = (i + 1ULL) & mask) {
+					if (entries[index - 1U].key == key) {
+						value = entries[index - 1U].value;
+						id = index - 1U;
+						return true;
+					}
+				}
+				return false;
+			}
+			auto indexes{ bin.data() + header.indexOffset };
+			SizeT lo{ }, hi{ header.count };
+			while (lo < hi) {
+				auto mid{ lo + (hi - lo) / 2ULL };
+				if (details::ConfigLoad<details::ConfigIndex>(indexes + mid * sizeof(details::ConfigIndex)).hash < hash) lo = mid + 1ULL;
+				else hi = mid;
+			}
+			for (; lo < header.count; ++lo) {
+				auto index{ details::ConfigLoad<details::ConfigIndex>(indexes + lo * sizeof(details::ConfigIndex)) };
+				if (index.hash != hash) break;
+				auto block{ _find_block(index.offset) };
+				if (block == header.blockCount || !_verify_block(block)) continue;
+				auto blockInfo{ _block(block) };
+				auto p{ bin.data() + index.offset }, end{ bin.data() + blockInfo.offset + blockInfo.size };
+				if (utf8) {
+					BinView entryKey;
+					if (details::ConfigParseEntry(p, end, entryKey, value) && details::ConfigKeyEqual(entryKey, key)) {
+						id = lo;
+						return true;
+					}
+				}
+				else if (std::wstring_view entryKey; details::ConfigParseEntry(p, end, entryKey, value, typed) && entryKey == key) {
+					id = lo;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		[[nodiscard]] ConfigType _value(std::wstring_view key, BinView& body, SizeT& id) const noexcept {
+			BinView stored;
+			if (!_find(key, stored, id)) return ConfigType::None;
+			if (!indexed) { // ʱѲ
+				body = stored;
+				return entries[id].type;
+			}
+			return details::ConfigSplit(stored, typed, body);
+		}
+
+		void _entry(BinView stored, Entry& entry) const noexcept {
+			entry.type = details::ConfigSplit(stored, typed, entry.value);
+			entry.tag = entry.type == ConfigType::Raw ? mqbyte{ } : *stored.data();
+		}
+
+		// 汾2ʽ˳ĿбУʧܵĿ
+		void _list() const noexcept {
+			if (!indexed || listed.load(std::memory_order_acquire)) return; // ɸʽʧܵͼ轨
+			std::lock_guard lock{ mutex };
+			if (listed.load(std::memory_order_relaxed)) return;
+			mqlist<Entry> list;
+			mqlist<BinView> keys; // UTF-8ȫͳһ
+			list.reserve(header.count);
+			SizeT keySize{ };
+			for (SizeT i{ }; i < header.blockCount; ++i) {
+				if (!_verify_block(i)) continue;
+				auto block{ _block(i) };
+				for (ConstPointT p{ bin.data() + block.offset }, end{ p + block.size }; p && p != end; ) {
+					Entry entry;
+					if (utf8) {
+						BinView key;
+						if ((p = details::ConfigParseEntry(p, end, key, entry.value))) {
+							keySize += keys.add(key).size();
+							_entry(entry.value, entry);
+							list.add(entry);
+						}
+					}
+					else if ((p = details::ConfigParseEntry(p, end, entry.key, entry.value, typed))) {
+						_entry(entry.value, entry);
+						list.add(entry);
+					}
+				}
+			}
+			if (utf8 && !_names(keys, list.data(), keySize)) list.clear();
+			entries.resize(list.size());
+			freestanding::copy(entries.data(), list.data(), list.size() * sizeof(Entry));
+			listed.store(true, std::memory_order_release);
+		}
+		// UTF-8뵽nameslistļýÿֽΪһUTF-16ַ
+		bool _names(mqlist<BinView> const& keys, Entry* list, SizeT keySize) const noexcept {
+			names.resize(keySize);
+			auto out{ names.data() };
+			for (auto& key : keys) {
+				auto size{ details::ConfigKeyRead(key, out) };
+				if (size == ~0ULL) return false;
+				list++->key = { out, size };
+				out += size;
+			}
+			return true;
+		}
+
+		// ոʽһνȫĿϣnames
+		bool _load_compact(BinView bv) noexcept {
+			ConstPointT p{ bv.data() + sizeof(mqui32) }, end{ bv.data() + bv.size() };
+			SizeT total{ };
+			// ÿĿֽٰ
+			if (!(p = details::VarintRead(p, end, total)) || total > static_cast<SizeT>(end - p) / 2ULL) return false;
+			mqlist<BinView> keys;
+			keys.reserve(total);
+			entries.resize(total);
+			SizeT keySize{ };
+			for (SizeT i{ }; i < total; ++i) {
+				BinView key;
+				if (!(p = details::ConfigParseEntry(p, end, key, entries[i].value))) return _fail();
+				keySize += keys.add(key).size();
+				_entry(entries[i].value, entries[i]);
+			}
+			if (p != end || !_names(keys, entries.data(), keySize)) return _fail();
+			SizeT tableSize{ 4ULL };
+			while (tableSize < total * 2ULL) tableSize <<= 1ULL;
+			table.resize(tableSize);
+			auto mask{ tableSize - 1ULL };
+			for (SizeT i{ }; i < total; ++i) {
+				auto slot{ details::ConfigHash(entries[i].key) & mask };
+				bool duplicate{ };
+				for (; auto index{ table[slot] }; slot = (slot + 1ULL) & mask) {
+					if (entries[index - 1U].key == entries[i].key) { // ظ׸Config::loadһ
+						duplicate = true;
+						break;
+					}
+				}
+				if (!duplicate) {
+					entries[count] = entries[i];
+					table[slot] = static_cast<mqui32>(++count);
+				}
+			}
+			return true;
+		}
+	public:
+		ConfigView() = default;
+
+		// ֽڼ
+		explicit ConfigView(BinView bv) noexcept {
+			load(bv);
+		}
+
+		ConfigView(ConfigView const&) = delete;
+		ConfigView& operator = (ConfigView const&) = delete;
+
+		~ConfigView() noexcept {
+			_release();
+		}
+
+		[[nodiscard]] bool empty() const noexcept {
+			return count == 0ULL;
+		}
+
+		[[nodiscard]] SizeT size() const noexcept {
+			return count;
+		}
+
+		[[nodiscard]] bool contains(std::wstring_view key) const noexcept {
+			BinView value;
+			SizeT id;
+			return _find(key, value, id);
+		}
+
+		/// <summary>
+		/// Ŀ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="entry">Ŀòkey</param>
+		/// <returns>ڷtrue</returns>
+		[[nodiscard]] bool find(std::wstring_view key, Entry& entry) const noexcept {
+			BinView stored;
+			SizeT id;
+			if (!_find(key, stored, id)) return false;
+			if (indexed) _entry(stored, entry);
+			else entry = entries[id];
+			entry.key = key;
+			return true;
+		}
+
+		[[nodiscard]] Entry const* begin() const noexcept {
+			_list();
+			return entries.cbegin();
+		}
+
+		[[nodiscard]] Entry const* end() const noexcept {
+			_list();
+			return entries.cbegin() + (indexed ? entries.size() : count);
+		}
+
+		/// <summary>
+		/// ȡ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <returns>ͣʱNone</returns>
+		[[nodiscard]] ConfigType type(std::wstring_view key) const noexcept {
+			BinView body;
+			SizeT id;
+			return _value(key, body, id);
+		}
+
+		/// <summary>
+		/// ȡ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="default_value">Ĭֵ</param>
+		/// <typeparam name="T">֧ͣ򸡵</typeparam>
+		/// <returns>ֵͲݻ򳬳TķΧʱĬֵ</returns>
+		template<freestanding::numeric T>
+		[[nodiscard]] T get(std::wstring_view key, T default_value = { }) const noexcept {
+			BinView body;
+			SizeT id;
+			T value;
+			return details::ConfigNumber(_value(key, body, id), body, value) ? value : default_value;
+		}
+
+		/// <summary>
+		/// ȡַ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="default_value">Ĭֵ</param>
+		/// <returns>ֵ</returns>
+		[[nodiscard]] std::wstring get(std::wstring_view key, std::wstring_view default_value = { }) const noexcept {
+			BinView body;
+			SizeT id;
+			if (auto type{ _value(key, body, id) }; type == ConfigType::String || type == ConfigType::Raw) {
+				return details::ConfigString(type, body);
+			}
+			return std::wstring{ default_value };
+		}
+
+		/// <summary>
+		/// ȡUTF-8ַãת
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="default_value">Ĭֵ</param>
+		/// <returns>ԭַͼɸʽUTF-16ַĬֵ</returns>
+		[[nodiscard]] std::u8string_view get_u8(std::wstring_view key, std::u8string_view default_value = { }) const noexcept {
+			BinView body;
+			SizeT id;
+			if (_value(key, body, id) == ConfigType::String) {
+				return { reinterpret_cast<char8_t const*>(body.data()), body.size() };
+			}
+			return default_value;
+		}
+
+		/// <summary>
+		/// ȡֽڼ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="default_value">Ĭֵ</param>
+		/// <returns>ԭֽڼͼ</returns>
+		[[nodiscard]] BinView get_bin(std::wstring_view key, BinView default_value = { }) const noexcept {
+			BinView body;
+			SizeT id;
+			if (auto type{ _value(key, body, id) }; type == ConfigType::Bytes || type == ConfigType::Raw) {
+				return body;
+			}
+			return default_value;
+		}
+
+		/// <summary>
+		/// ȡ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <typeparam name="T">Ԫַ֧ͣ</typeparam>
+		/// <returns>飬Ͳʱؿ</returns>
+		template<details::config_element T>
+		[[nodiscard]] mqlist<T> get_array(std::wstring_view key) const noexcept {
+			BinView body;
+			SizeT id;
+			mqlist<T> values;
+			if (!details::ConfigArray(_value(key, body, id), body, values)) {
+				values.clear();
+			}
+			return values;
+		}
+
+		/// <summary>
+		/// ȡã״ηʱ֮ԭָػ
+		/// </summary>
+		/// <param name="key"></param>
+		/// <returns>ͼʱؿͼ</returns>
+		[[nodiscard]] ConfigView const& get_config(std::wstring_view key) const noexcept {
+			BinView body;
+			SizeT id;
+			if (auto type{ _value(key, body, id) }; type == ConfigType::Config || type == ConfigType::Raw) {
+				if (!childrenReady.load(std::memory_order_acquire)) {
+					std::lock_guard lock{ mutex };
+					if (!childrenReady.load(std::memory_order_relaxed)) {
+						children.resize(count);
+						childrenReady.store(true, std::memory_order_release);
+					}
+				}
+				auto& slot{ children[id] };
+				auto child{ slot.load(std::memory_order_acquire) };
+				if (!child) { // ״ηʱԽֻȷһ
+					auto parsed{ new ConfigView(body) };
+					if (slot.compare_exchange_strong(child, parsed, std::memory_order_acq_rel, std::memory_order_acquire)) {
+						child = parsed;
+					}
+					else {
+						delete parsed;
+					}
+				}
+				return *child;
+			}
+			static ConfigView const _empty_view;
+			return _empty_view;
+		}
+
+		/// <summary>
+		/// У飬汾2ʽУݿ
+		/// </summary>
+		/// <returns>true</returns>
+		[[nodiscard]] bool verify() const noexcept {
+			if (!indexed) return true; // ɸʽУֵʱѼ鳤
+			if (header.indexCrc != Data::CRC32({ bin.data() + header.indexOffset, header.count * sizeof(details::ConfigIndex) })) return false;
+			for (SizeT i{ }; i < header.blockCount; ++i) {
+				if (!_verify_block(i)) return false;
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// ֽڼ룬ԶʶʽУгȲԽ
+		/// </summary>
+		/// <param name="bv">ֽڼ</param>
+		/// <returns>trueͼΪ</returns>
+		bool load(BinView bv) noexcept {
+			entries.clear();
+			names.clear();
+			table.clear();
+			verified.clear();
+			_release();
+			bin = bv;
+			header = { };
+			indexed = false;
+			typed = false;
+			utf8 = false;
+			count = 0ULL;
+			listed.store(true, std::memory_order_relaxed);
+			if (details::ConfigIsV2(bv)) {
+				if (!details::ConfigCheckHeader(bv, header)) return false;
+				listed.store(false, std::memory_order_relaxed);
+				indexed = true;
+				typed = (header.flags & details::ConfigFlagTyped) != 0U;
+				utf8 = typed && (header.flags & details::ConfigFlagUtf8Key) != 0U;
+				count = header.count;
+				verified.resize(header.blockCount);
+				return true;
+			}
+			if (details::ConfigIsCompact(bv)) {
+				typed = true;
+				utf8 = true;
+				return _load_compact(bv);
+			}
+			ConstPointT p{ bv.data() }, end{ bv.data() + bv.size() };
+			SizeT total{ };
+			if (bv.size() < sizeof(SizeT)) return bv.size() == 0ULL;
+			p = details::Read(p, total);
+			// ÿĿֶٰ
+			if (total > static_cast<SizeT>(end - p) / (sizeof(SizeT) * 2ULL)) return false;
+			entries.resize(total);
+			SizeT tableSize{ 4ULL };
+			while (tableSize < total * 2ULL) tableSize <<= 1ULL;
+			table.resize(tableSize);
+			auto mask{ tableSize - 1ULL };
+			for (SizeT i{ }; i < total; ++i) {
+				std::wstring_view key;
+				BinView value;
+				if (!(p = details::ConfigParseEntry(p, end, key, value))) return _fail();
+				auto slot{ details::ConfigHash(key) & mask };
+				bool duplicate{ };
+				for (; auto index{ table[slot] }; slot = (slot + 1ULL) & mask) {
+					if (entries[index - 1U].key == key) { // ظ׸Config::loadһ
+						duplicate = true;
+						break;
+					}
+				}
+				if (!duplicate) {
+					entries[count].key = key;
+					entries[count].type = ConfigType::Raw;
+					entries[count].tag = 0U;
+					entries[count].value = value;
+					table[slot] = static_cast<mqui32>(++count);
+				}
+			}
+			return true;
+		}
+	};
+
+	/// <summary>
+	/// ò죬ñȽϵõӦõû򱣴Ϊֽڼͬ
+	/// </summary>
+	export struct ConfigPatch {
+		Config changed; // ޸ĵ
+		mqlist<std::wstring> removed; // Ƴ
+
+		ConfigPatch() = default;
+
+		/// <summary>
+		/// ȽãֵͱֽڱȽ
+		/// </summary>
+		/// <param name="from">ԭ</param>
+		/// <param name="to"></param>
+		ConfigPatch(Config const& from, Config const& to) noexcept {
+			for (auto& [key, value] : to) {
+				if (auto iter{ from.find(key) }; iter == from.end() || !(iter->second == value)) {
+					changed.try_emplace(key, value);
+				}
+			}
+			for (auto& [key, value] : from) {
+				if (!to.contains(key)) {
+					removed.add(key);
+				}
+			}
+		}
+
+		/// <summary>
+		/// ȽͼֻΪв÷ֵ
+		/// </summary>
+		/// <param name="from">ԭͼ</param>
+		/// <param name="to">ͼ</param>
+		ConfigPatch(ConfigView const& from, ConfigView const& to) noexcept {
+			ConfigView::Entry old;
+			for (auto& entry : to) {
+				if (!from.find(entry.key, old) || old.tag != entry.tag || !(old.value == entry.value)) {
+					changed.try_emplace(std::wstring(entry.key), details::ConfigValue(entry.tag, entry.value));
+				}
+			}
+			for (auto& entry : from) {
+				if (!to.contains(entry.key)) {
+					removed.add(entry.key);
+				}
+			}
+		}
+
+		// ֽڼ
+		explicit ConfigPatch(BinView bv) noexcept {
+			load(bv);
+		}
+
+		[[nodiscard]] bool empty() const noexcept {
+			return changed.empty() && removed.size() == 0ULL;
+		}
+
+		/// <summary>
+		/// Ӧõ
+		/// </summary>
+		/// <param name="config"></param>
+		void apply(Config& config) const noexcept {
+			for (auto& key : removed) {
+				config.remove(key);
+			}
+			config.merge(changed, ConfigMerge::Override);
+		}
+
+		/// <summary>
+		/// ֽڼ
+		/// </summary>
+		/// <param name="bv">ֽڼ</param>
+		/// <returns>true</returns>
+		bool load(BinView bv) noexcept {
+			Config patch;
+			auto ok{ patch.load(bv) };
+			changed = patch.get_config(L"changed");
+			removed = patch.get_array<std::wstring>(L"removed");
+			return ok;
+		}
+
+		/// <summary>
+		/// ֽڼ
+		/// </summary>
+		/// <returns>ֽڼ</returns>
+		[[nodiscard]] Bin save() const noexcept {
+			Config patch;
+			patch.set(L"changed", changed);
+			patch.set(L"removed", removed);
+			return patch.save(ConfigFormat::Compact);
+		}
+	};
+
+	/// <summary>
+	/// <para>־ʽô洢set/removeֻ־ļ׷һCRC32ļ¼д޸</para>
+	/// <para>ʱղ˳ط־ضϻУʧܵļ¼ֹͣȥ</para>
+	/// <para>־ֵҴڿʱԶѹ¿дʱļˢº滻ԭգ־</para>
+	/// </summary>
+	export struct ConfigJournal {
+		using SizeT = mqui64;
+	private:
+		enum : mqbyte { OpSet = 1U, OpRemove = 2U, OpSetUtf8 = 3U, OpRemoveUtf8 = 4U }; // ǰΪڵUTF-16¼ֻطʱȡ
+
+		Config cfg;
+		std::wstring snapshotPath, journalPath;
+		mqhandle journal{ };
+		SizeT journalSize{ };
+		SizeT snapshotSize{ };
+		SizeT threshold{ 1024ULL * 1024ULL };
+		SizeT retryAt{ }; // Զѹʧܺ־óǰ
+		bool sync{ };
+		bool compactError{ };
+
+		void _truncate(SizeT size) noexcept {
+			api::SetFilePointerEx(journal, static_cast<mqi64>(size), nullptr, 0U);
+			api::SetEndOfFile(journal);
+		}
+
+		// ¼ΪCRC32ݳȡ䳤UTF-8ֵCRC32ֽ
+		bool _append(mqbyte op, std::wstring_view key, BinView value) noexcept {
+			if (!journal) return false;
+			auto keySize{ details::ConfigKeySize(key) };
+			auto payload{ 1ULL + details::VarintSize(keySize) + keySize + value.size() };
+			Bin record(sizeof(mqui32) * 2ULL + payload);
+			auto p{ details::WriteImpl(record.data() + sizeof(mqui32), static_cast<mqui32>(payload)) };
+			*p++ = op;
+			p = details::ConfigKeyWrite(details::VarintWrite(p, keySize), key);
+			freestanding::copy(p, value.data(), value.size());
+			details::WriteImpl(record.data(), Data::CRC32({ record.data() + sizeof(mqui32), record.size() - sizeof(mqui32) }));
+			if (!details::ConfigWriteFile(journal, record) || (sync && !api::FlushFileBuffers(journal))) {
+				_truncate(journalSize); // дһļ¼֤֮׷Կط
+				return false;
+			}
+			journalSize += record.size();
+			return true;
+		}
+
+		// ڴøºԶѹѹʧܲӰ챾׷ӵĽֻcompact_failed
+		void _autocompact() noexcept {
+			if (journalSize > threshold && journalSize > snapshotSize && journalSize >= retryAt && !compact()) {
+				compactError = true;
+				retryAt = journalSize + threshold;
+			}
+		}
+
+		// ط־Чݳ
+		[[nodiscard]] SizeT _replay(BinView log) noexcept {
+			mqcbytes p{ log.data() }, end{ log.data() + log.size() };
+			std::wstring name;
+			while (static_cast<SizeT>(end - p) > sizeof(mqui32) * 2ULL) {
+				auto crc{ details::ConfigLoad<mqui32>(p) };
+				auto size{ details::ConfigLoad<mqui32>(p + sizeof(mqui32)) };
+				if (size == 0U || size > static_cast<SizeT>(end - p) - sizeof(mqui32) * 2ULL) break;
+				if (crc != Data::CRC32({ p + sizeof(mqui32), size + sizeof(mqui32) })) break;
+				mqcbytes q{ p + sizeof(mqui32) * 2ULL }, recordEnd{ q + size };
+				auto op{ *q++ };
+				bool utf8{ op == OpSetUtf8 || op == OpRemoveUtf8 };
+				SizeT keySize{ };
+				if (!(q = details::VarintRead(q, recordEnd, keySize)) || keySize > static_cast<SizeT>(recordEnd - q) || (!utf8 && keySize % sizeof(mqchar))) break;
+				std::wstring_view key{ reinterpret_cast<mqcstr>(q), keySize / sizeof(mqchar) };
+				if (utf8) {
+					if (!details::ConfigKeyString({ q, keySize }, name)) break;
+					key = name;
+				}
+				q += keySize;
+				if ((op == OpSet || op == OpSetUtf8) && q != recordEnd) {
+					cfg._set(key, Bin{ q, static_cast<SizeT>(recordEnd - q) });
+				}
+				else if ((op == OpRemove || op == OpRemoveUtf8) && q == recordEnd) {
+					cfg.remove(key);
+				}
+				else break;
+				p = recordEnd;
+			}
+			return static_cast<SizeT>(p - log.data());
+		}
+	public:
+		ConfigJournal() = default;
+
+		/// <summary>
+		/// ô洢
+		/// </summary>
+		/// <param name="path">ļ־ļΪ׷.journal</param>
+		/// <param name="sync">ÿ¼дǷˢµ</param>
+		explicit ConfigJournal(std::wstring_view path, bool sync = true) noexcept {
+			open(path, sync);
+		}
+
+		ConfigJournal(ConfigJournal const&) = delete;
+		ConfigJournal& operator = (ConfigJournal const&) = delete;
+
+		~ConfigJournal() noexcept {
+			close();
+		}
+
+		/// <summary>
+		/// ô洢ղط־
+		/// </summary>
+		/// <param name="path">ļ־ļΪ׷.journal</param>
+		/// <param name="sync">ÿ¼дǷˢµ</param>
+		/// <returns>ղĿմʧܡ𻵻־޷ʱfalse</returns>
+		bool open(std::wstring_view path, bool sync = true) noexcept {
+			close();
+			snapshotPath = path;
+			journalPath = snapshotPath + L".journal";
+			this->sync = sync;
+			if (auto hFile{ api::CreateFileW(snapshotPath.data(), 0x80000000U, 0x00000001U, nullptr, 3U, 0x00000080U, nullptr) };
+				hFile != reinterpret_cast<mqhandle>(-1)) {
+				Bin snapshot;
+				auto ok{ details::ConfigReadFile(hFile, snapshot) };
+				api::CloseHandle(hFile);
+				if (!ok || !cfg.load(snapshot)) {
+					close();
+					return false;
+				}
+				snapshotSize = snapshot.size();
+			}
+			else if (api::GetLastError() != 2U) { // ֻERROR_FILE_NOT_FOUNDʾ޿գܾʵȴܵ
+				return false;
+			}
+			journal = api::CreateFileW(journalPath.data(), 0x80000000U | 0x40000000U, 0x00000001U, nullptr, 4U, 0x00000080U, nullptr);
+			if (journal == reinterpret_cast<mqhandle>(-1)) {
+				journal = nullptr;
+				close();
+				return false;
+			}
+			Bin log;
+			if (!details::ConfigReadFile(journal, log)) {
+				close();
+				return false;
+			}
+			journalSize = _replay(log);
+			_truncate(journalSize);
+			return true;
+		}
+
+		/// <summary>
+		/// رô洢׷ӵļ¼д
+		/// </summary>
+		void close() noexcept {
+			if (journal) {
+				api::CloseHandle(journal);
+				journal = nullptr;
+			}
+			cfg.clear();
+			journalSize = 0ULL;
+			snapshotSize = 0ULL;
+			retryAt = 0ULL;
+			compactError = false;
+		}
+
+		[[nodiscard]] bool opened() const noexcept {
+			return journal != nullptr;
+		}
+
+		/// <summary>
+		/// ǰ
+		/// </summary>
+		[[nodiscard]] Config const& config() const noexcept {
+			return cfg;
+		}
+
+		/// <summary>
+		/// ־ļ
+		/// </summary>
+		[[nodiscard]] SizeT journal_size() const noexcept {
+			return journalSize;
+		}
+
+		/// <summary>
+		/// Զѹֵ־óҴڿʱѹ
+		/// </summary>
+		/// <param name="size">ֽ</param>
+		void compact_threshold(SizeT size) noexcept {
+			threshold = size;
+		}
+
+		/// <summary>
+		/// һԶѹǷʧܣʧܺ¼ճ׷ӣ־һֵʱԣֶcompactɹ
+		/// </summary>
+		[[nodiscard]] bool compact_failed() const noexcept {
+			return compactError;
+		}
+
+		/// <summary>
+		/// ò׷־¼
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="value">ֵ֧Config::setܵ</param>
+		/// <returns>¼дɹtrue</returns>
+		template<typename T>
+		requires requires(Config& c, std::wstring_view key, T&& value) { c.set(key, freestanding::forward<T>(value)); }
+		bool set(std::wstring_view key, T&& value) noexcept {
+			if (!journal) return false;
+			// Ƴֵ¼дʧʱԭڴ̱һ
+			auto iter{ cfg.find(key) };
+			auto existed{ iter != cfg.end() };
+			Bin old;
+			if (existed) old = freestanding::move(iter->second);
+			cfg.set(key, freestanding::forward<T>(value));
+			iter = cfg.find(key);
+			if (!_append(OpSetUtf8, key, iter->second)) {
+				if (existed) iter->second = freestanding::move(old);
+				else cfg.erase(iter);
+				return false;
+			}
+			_autocompact();
+			return true;
+		}
+
+		/// <summary>
+		/// Ƴò׷־¼
+		/// </summary>
+		/// <param name="key"></param>
+		/// <returns>òڻ¼дʧܷfalse</returns>
+		bool remove(std::wstring_view key) noexcept {
+			if (!journal || !cfg.contains(key)) return false;
+			if (!_append(OpRemoveUtf8, key, { })) return false;
+			cfg.remove(key);
+			_autocompact();
+			return true;
+		}
+
+		/// <summary>
+		/// ѹдղ־
+		/// </summary>
+		/// <returns>ɹtrueʧʱԭ־ֲ</returns>
+		bool compact() noexcept {
+			if (!journal) return false;
+			auto snapshot{ cfg.save() };
+			auto tmpPath{ snapshotPath + L".tmp" };
+			if (!details::ConfigSaveFile(tmpPath.data(), snapshot)) return false;
+			// MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH
+			if (!api::MoveFileExW(tmpPath.data(), snapshotPath.data(), 0x00000001U | 0x00000008U)) return false;
+			snapshotSize = snapshot.size();
+			// ¿Ѱ־еȫ޸ģǰʱطŽ
+			_truncate(0ULL);
+			if (sync) api::FlushFileBuffers(journal);
+			journalSize = 0ULL;
+			retryAt = 0ULL;
+			compactError = false;
+			return true;
+		}
+	};
+}
@@ -2,49 +2,134 @@ module;
 #include "MasterQian.Meta.h"
 #include <string>
 #include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <bit>
+#include <emmintrin.h>
 #define MasterQianModuleVersion 20240131ULL
 
 export module MasterQian.Parser.Ini;
 export import MasterQian.freestanding;
 
+namespace MasterQian::api {
+	META_WINAPI(mqbool, CloseHandle, mqhandle);
+	META_WINAPI(mqhandle, CreateFileW, mqcstr, mqui32, mqui32, mqhandle, mqui32, mqui32, mqhandle);
+	META_WINAPI(mqbool, ReadFile, mqhandle, mqmem, mqui32, mqui32*, mqhandle);
+	META_WINAPI(mqbool, GetFileSizeEx, mqhandle, mqi64*);
+	META_WINAPI(mqbool, ReadDirectoryChangesW, mqhandle, mqmem, mqui32, mqbool, mqui32, mqui32*, mqmem, mqmem);
+	META_WINAPI(mqhandle, CreateEventW, mqmem, mqbool, mqbool, mqcstr);
+	META_WINAPI(mqbool, SetEvent, mqhandle);
+	META_WINAPI(mqui32, WaitForSingleObject, mqhandle, mqui32);
+	META_WINAPI(mqui32, WaitForMultipleObjects, mqui32, mqhandle*, mqbool, mqui32);
+	META_WINAPI(mqbool, GetOverlappedResult, mqhandle, mqmem, mqui32*, mqbool);
+	META_WINAPI(mqbool, CancelIoEx, mqhandle, mqmem);
+}
+
+#pragma comment(linker,"/alternatename:__imp_?CloseHandle@api@MasterQian@@YAHPEAX@Z::<!MasterQian.Parser.Ini>=__imp_CloseHandle")
+#pragma comment(linker,"/alternatename:__imp_?CreateFileW@api@MasterQian@@YAPEAXPEB_WIIPEAXII1@Z::<!MasterQian.Parser.Ini>=__imp_CreateFileW")
+#pragma comment(linker,"/alternatename:__imp_?ReadFile@api@MasterQian@@YAHPEAX0IPEAI0@Z::<!MasterQian.Parser.Ini>=__imp_ReadFile")
+#pragma comment(linker,"/alternatename:__imp_?GetFileSizeEx@api@MasterQian@@YAHPEAXPEA_J@Z::<!MasterQian.Parser.Ini>=__imp_GetFileSizeEx")
+#pragma comment(linker,"/alternatename:__imp_?ReadDirectoryChangesW@api@MasterQian@@YAHPEAX0IHIPEAI00@Z::<!MasterQian.Parser.Ini>=__imp_ReadDirectoryChangesW")
+#pragma comment(linker,"/alternatename:__imp_?CreateEventW@api@MasterQian@@YAPEAXPEAXHHPEB_W@Z::<!MasterQian.Parser.Ini>=__imp_CreateEventW")
+#pragma comment(linker,"/alternatename:__imp_?SetEvent@api@MasterQian@@YAHPEAX@Z::<!MasterQian.Parser.Ini>=__imp_SetEvent")
+#pragma comment(linker,"/alternatename:__imp_?WaitForSingleObject@api@MasterQian@@YAIPEAXI@Z::<!MasterQian.Parser.Ini>=__imp_WaitForSingleObject")
+#pragma comment(linker,"/alternatename:__imp_?WaitForMultipleObjects@api@MasterQian@@YAIIPEAPEAXHI@Z::<!MasterQian.Parser.Ini>=__imp_WaitForMultipleObjects")
+#pragma comment(linker,"/alternatename:__imp_?GetOverlappedResult@api@MasterQian@@YAHPEAX0PEAIH@Z::<!MasterQian.Parser.Ini>=__imp_GetOverlappedResult")
+#pragma comment(linker,"/alternatename:__imp_?CancelIoEx@api@MasterQian@@YAHPEAX0@Z::<!MasterQian.Parser.Ini>=__imp_CancelIoEx")
+
 namespace MasterQian::Parser {
 	namespace details {
-		mqcstr IniScanLine(mqcstr pData, mqcstr* p1, mqcstr* p2, mqcstr* p3, mqcstr* p4) {
-			mqcstr pStart{ pData };
-			while (*pData && *pData != L'\r' && *pData != L'\n') ++pData; // Ѱҵβ
-			mqcstr pEnd{ pData };
-			while (*pStart == L' ' || *pStart == L'\t') ++pStart; // ׵Ŀհ
-			while (*pEnd == L'\r' || *pEnd == L'\n') --pEnd; // βĻ
-			while (*pEnd == L'\0' || *pEnd == L' ' || *pEnd == L'\t') --pEnd; // βĿհ
-			std::wstring_view line{ pStart, pEnd + 1ULL };
-			while (*pData == L'\r' || *pData == L'\n') ++pData; // βĻ
+		template<typename Char>
+		concept ini_char = freestanding::same<Char, char> || freestanding::same<Char, char8_t> || freestanding::same<Char, mqchar>;
+
+		template<ini_char Char>
+		inline constexpr bool IniBlank(Char c) noexcept {
+			return c == static_cast<Char>(' ') || c == static_cast<Char>('\t');
+		}
+
+		template<ini_char Char>
+		inline constexpr bool IniNewLine(Char c) noexcept {
+			return c == static_cast<Char>('\r') || c == static_cast<Char>('\n');
+		}
+
+		// trim[pStart, pEnd)࣬pEqualΪһ'='nullptrǷзfalse
+		// ʱp1p2Ϊʱp1p2Ϊp3p4Ϊֵע;Ϊnullptr
+		template<ini_char Char>
+		bool IniClassifyLine(Char const* pStart, Char const* pEnd, Char const* pEqual, Char const** p1, Char const** p2, Char const** p3, Char const** p4) noexcept {
 			*p1 = *p2 = *p3 = *p4 = nullptr;
-			if (line.front() == L'[' && line.back() == L']') { // 
-				pStart = &line.front() + 1;
-				pEnd = &line.back() - 1;
-				while (*pStart == L' ' || *pStart == L'\t') ++pStart; // [Ŀհ
-				while (*pEnd == L' ' || *pEnd == L'\t') --pEnd; // ]ǰĿհ
+			if (pStart == pEnd || *pStart == static_cast<Char>(';')) { } // ע
+			else if (pEnd - pStart > 1 && *pStart == static_cast<Char>('[') && pEnd[-1] == static_cast<Char>(']')) { // 
+				++pStart;
+				--pEnd;
+				while (pStart != pEnd && IniBlank(*pStart)) ++pStart; // [Ŀհ
+				while (pEnd != pStart && IniBlank(pEnd[-1])) --pEnd; // ]ǰĿհ
 				// (p1 == p2ǿս)
 				*p1 = pStart;
-				*p2 = pEnd + 1;
-			}
-			else if (line.front() == L';') { } // ע
-			else if (auto pos{ line.rfind(L'=') }; pos != std::wstring_view::npos) { // 
-				auto left{ line.substr(0, pos) };
-				auto right{ line.substr(pos + 1) };
-				pEnd = &left.back();
-				pStart = &right.front();
-				while (*pEnd == L' ' || *pEnd == L'\t') --pEnd; // =ǰĿհ
-				while (*pStart == L' ' || *pStart == L'\t') ++pStart; // =Ŀհ
-				*p1 = &left.front(); // 
-				*p2 = pEnd + 1;
-				*p3 = pStart; // ֵ
-				*p4 = &right.back() + 1;
+				*p2 = pEnd;
+			}
+			else if (pEqual) { // 
+				Char const* pKey{ pEqual };
+				Char const* pValue{ pEqual + 1 };
+				while (pKey != pStart && IniBlank(pKey[-1])) --pKey; // =ǰĿհ
+				while (pValue != pEnd && IniBlank(*pValue)) ++pValue; // =Ŀհ
+				*p1 = pStart; // 
+				*p2 = pKey;
+				*p3 = pValue; // ֵ
+				*p4 = pEnd;
 			}
 			else {
-				return nullptr;
+				return false;
+			}
+			return true;
+		}
+
+		inline constexpr mqui64 IniWindowSize{ 1ULL << 20ULL }; // ÿνַ
+		inline constexpr mqui64 IniParallelSize{ 1ULL << 18ULL }; // нʱÿεַ
+
+		template<ini_char Char>
+		inline constexpr bool IniToken(Char c) noexcept {
+			return c == static_cast<Char>('\r') || c == static_cast<Char>('\n') || c == static_cast<Char>('=');
+		}
+
+		template<ini_char Char>
+		inline __m128i IniTokenMask(__m128i v) noexcept {
+			if constexpr (sizeof(Char) == 1ULL) {
+				return _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+					_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))), _mm_cmpeq_epi8(v, _mm_set1_epi8('=')));
+			}
+			else {
+				return _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, _mm_set1_epi16(L'\r')),
+					_mm_cmpeq_epi16(v, _mm_set1_epi16(L'\n'))), _mm_cmpeq_epi16(v, _mm_set1_epi16(L'=')));
+			}
+		}
+
+		// [data, data + size)'\r''\n''='ƫSSE2ÿαȽ32ֽ
+		template<ini_char Char>
+		void IniTokenize(Char const* data, mqui64 size, mqlist<mqui32>& tokens) noexcept {
+			tokens.clear();
+			auto bytes{ reinterpret_cast<mqcbytes>(data) };
+			auto total{ size * sizeof(Char) };
+			mqui64 i{ };
+			for (; i + 32ULL <= total; i += 32ULL) {
+				auto lo{ static_cast<mqui32>(_mm_movemask_epi8(IniTokenMask<Char>(_mm_loadu_si128(reinterpret_cast<__m128i const*>(bytes + i))))) };
+				auto hi{ static_cast<mqui32>(_mm_movemask_epi8(IniTokenMask<Char>(_mm_loadu_si128(reinterpret_cast<__m128i const*>(bytes + i + 16ULL))))) };
+				auto mask{ lo | (hi << 16U) };
+				if constexpr (sizeof(Char) == 2ULL) {
+					mask &= 0x55555555U; // ÿַλֻȡλ
+				}
+				for (; mask; mask &= mask - 1U) {
+					tokens.add(static_cast<mqui32>((i + static_cast<mqui64>(std::countr_zero(mask))) / sizeof(Char)));
+				}
+			}
+			for (i /= sizeof(Char); i < size; ++i) {
+				if (IniToken(data[i])) {
+					tokens.add(static_cast<mqui32>(i));
+				}
 			}
-			return pData;
 		}
 	}
 
@@ -57,12 +142,297 @@ namespace MasterQian::Parser {
 		ISOLATED_ITEM // 
 	};
 
-	struct IniView;
+	namespace details {
+		// UTF-8UTF-16BOM
+		template<ini_char Char>
+		inline Char const* IniSkipBOM(Char const* pData, Char const* pLast) noexcept {
+			if constexpr (sizeof(Char) == 1ULL) {
+				if (pLast - pData >= 3 && static_cast<mqbyte>(pData[0]) == 0xEFU
+					&& static_cast<mqbyte>(pData[1]) == 0xBBU && static_cast<mqbyte>(pData[2]) == 0xBFU) {
+					return pData + 3;
+				}
+			}
+			else if (pData != pLast && *pData == static_cast<Char>(0xFEFF)) {
+				return pData + 1;
+			}
+			return pData;
+		}
+
+		// нʱsection(name)ʱitem(key, value)
+		// ڽ'\r''\n''='зַ࣬Ѱβ
+		template<ini_char Char, typename SectionFunc, typename ItemFunc>
+		IniError IniParse(std::basic_string_view<Char> data, SectionFunc&& section, ItemFunc&& item) noexcept {
+			Char const* pLast{ data.data() + data.size() };
+			Char const* pLine{ IniSkipBOM(data.data(), pLast) };
+			Char const* pEqual{ };
+			Char const* p1{ }, * p2{ }, * p3{ }, * p4{ };
+			bool hasSection{ };
+			auto line = [&](Char const* pEnd) noexcept {
+				Char const* pStart{ pLine };
+				while (pStart != pEnd && IniBlank(*pStart)) ++pStart; // ׵Ŀհ
+				while (pEnd != pStart && IniBlank(pEnd[-1])) --pEnd; // βĿհ
+				if (!IniClassifyLine(pStart, pEnd, pEqual, &p1, &p2, &p3, &p4)) {
+					return IniError::INVALID_LINE;
+				}
+				if (p3) { // 
+					if (!hasSection) return IniError::ISOLATED_ITEM;
+					if (p1 == p2) return IniError::EMPTY_KEY;
+					item(std::basic_string_view<Char>{ p1, p2 }, std::basic_string_view<Char>{ p3, p4 });
+				}
+				else if (p1) { // 
+					if (p1 == p2) return IniError::EMPTY_SECTION_NAME;
+					section(std::basic_string_view<Char>{ p1, p2 });
+					hasSection = true;
+				}
+				return IniError::OK;
+			};
+			mqlist<mqui32> tokens;
+			tokens.reserve(IniWindowSize / 16ULL);
+			for (Char const* pWindow{ pLine }; pWindow != pLast; ) {
+				auto size{ static_cast<mqui64>(pLast - pWindow) < IniWindowSize ? static_cast<mqui64>(pLast - pWindow) : IniWindowSize };
+				IniTokenize(pWindow, size, tokens);
+				for (auto token : tokens) {
+					Char const* pToken{ pWindow + token };
+					if (*pToken == static_cast<Char>('=')) {
+						pEqual = pToken;
+					}
+					else {
+						if (auto result{ line(pToken) }; result != IniError::OK) return result;
+						pLine = pToken + 1;
+						pEqual = nullptr;
+					}
+				}
+				pWindow += size;
+			}
+			return line(pLast);
+		}
+
+		// posеһѰҽУףҲʱdata.size()
+		// езежIniParseһ£'['ͷעǷжǽ
+		template<ini_char Char>
+		mqui64 IniNextSection(std::basic_string_view<Char> data, mqui64 pos) noexcept {
+			static constexpr Char NewLines[]{ static_cast<Char>('\r'), static_cast<Char>('\n') };
+			constexpr std::basic_string_view<Char> NewLine{ NewLines, 2ULL };
+			if (pos = data.find_first_of(NewLine, pos); pos == std::basic_string_view<Char>::npos) return data.size();
+			for (++pos; pos < data.size(); ) {
+				auto end{ data.find_first_of(NewLine, pos) };
+				if (end == std::basic_string_view<Char>::npos) end = data.size();
+				auto b{ pos }, e{ end };
+				while (b != e && IniBlank(data[b])) ++b;
+				while (e != b && IniBlank(data[e - 1ULL])) --e;
+				if (e - b > 1ULL && data[b] == static_cast<Char>('[') && data[e - 1ULL] == static_cast<Char>(']')) return pos;
+				pos = end + 1ULL;
+			}
+			return data.size();
+		}
+	}
+
+	// λKMGT1024λɴBiB׺
+	export struct IniSize {
+		mqui64 bytes;
+	};
+
+	namespace details {
+		template<typename T>
+		struct ini_duration : std::false_type { };
+
+		template<typename Rep, typename Period>
+		struct ini_duration<std::chrono::duration<Rep, Period>> : std::true_type { };
+
+		template<typename T>
+		concept ini_value = (freestanding::integral<T> && !freestanding::character<T>) || freestanding::floating_point<T>
+			|| freestanding::same<T, IniSize> || ini_duration<T>::value;
+
+		// ۵ͱţ0Ϊղۣ1ΪдУΪɻ
+		// ŶÿһĵַͬCOMDAT۵ͬĳϲͬһַ
+		inline constexpr mqbyte IniCacheEmpty{ 0U };
+		inline constexpr mqbyte IniCacheBusy{ 1U };
+
+		// ͵ıţ1ʼλģʽͬ͹ñţMSVCϵintlong
+		template<typename T>
+		inline constexpr mqbyte IniArithmeticId() noexcept {
+			if constexpr (freestanding::same<T, bool>) return 1U;
+			else if constexpr (freestanding::floating_point<T>) return sizeof(T) == sizeof(mqf32) ? 2U : 3U;
+			else if constexpr (freestanding::integral<T>) {
+				return static_cast<mqbyte>(4U + static_cast<mqui32>(std::countr_zero(sizeof(T))) * 2U + (static_cast<T>(-1) < static_cast<T>(0) ? 1U : 0U));
+			}
+			else return 0U;
+		}
+
+		// durationλıţ1ʼֻгõλɻ
+		template<typename Period>
+		inline constexpr mqbyte IniPeriodId() noexcept {
+			if constexpr (std::ratio_equal_v<Period, std::nano>) return 1U;
+			else if constexpr (std::ratio_equal_v<Period, std::micro>) return 2U;
+			else if constexpr (std::ratio_equal_v<Period, std::milli>) return 3U;
+			else if constexpr (std::ratio_equal_v<Period, std::ratio<1>>) return 4U;
+			else if constexpr (std::ratio_equal_v<Period, std::ratio<60>>) return 5U;
+			else if constexpr (std::ratio_equal_v<Period, std::ratio<3600>>) return 6U;
+			else if constexpr (std::ratio_equal_v<Period, std::ratio<86400>>) return 7U;
+			else return 0U;
+		}
+
+		// ͱţIniSizeΪ2Ϊ3~13durationΪ16(ʾ, λ)ţ0ʾɻ
+		template<typename T>
+		inline constexpr mqbyte IniCacheId() noexcept {
+			if constexpr (freestanding::same<T, IniSize>) return 2U;
+			else if constexpr (ini_duration<T>::value) {
+				constexpr auto rep{ IniArithmeticId<typename T::rep>() };
+				constexpr auto period{ IniPeriodId<typename T::period>() };
+				return rep && period ? static_cast<mqbyte>(16U + (rep - 1U) * 8U + (period - 1U)) : 0U;
+			}
+			else return static_cast<mqbyte>(2U + IniArithmeticId<T>());
+		}
+
+		// ɻͣλ8ֽڻ
+		template<typename T>
+		concept ini_cacheable = ini_value<T> && freestanding::copyable_memory<T> && sizeof(T) <= sizeof(mqui64) && IniCacheId<T>() != 0U;
+
+		inline constexpr bool IniIEqual(std::string_view a, std::string_view b) noexcept {
+			if (a.size() != b.size()) return false;
+			for (mqui64 i{ }; i < a.size(); ++i) {
+				auto c{ a[i] };
+				if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+				if (c != b[i]) return false;
+			}
+			return true;
+		}
+
+		// ֵֵΪASCIIֵֽfrom_charsʧʱresultѱд
+		template<ini_value T, ini_char Char>
+		bool IniParseValue(std::basic_string_view<Char> value, T& result) noexcept {
+			char buf[64];
+			if (value.size() >= sizeof(buf)) return false;
+			for (mqui64 i{ }; i < value.size(); ++i) {
+				if (static_cast<mqui32>(value[i]) >= 0x80U) return false;
+				buf[i] = static_cast<char>(value[i]);
+			}
+			char const* first{ buf };
+			char const* last{ buf + value.size() };
+			if constexpr (freestanding::same<T, bool>) {
+				std::string_view sv{ first, last };
+				if (IniIEqual(sv, "true") || IniIEqual(sv, "yes") || IniIEqual(sv, "on") || sv == "1") result = true;
+				else if (IniIEqual(sv, "false") || IniIEqual(sv, "no") || IniIEqual(sv, "off") || sv == "0") result = false;
+				else return false;
+				return true;
+			}
+			else if constexpr (freestanding::integral<T>) {
+				if (first != last && *first == '+') ++first;
+				int base{ 10 };
+				if (last - first > 2 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X')) {
+					first += 2;
+					base = 16;
+				}
+				auto [ptr, ec] { std::from_chars(first, last, result, base) };
+				return ec == std::errc{ } && ptr == last;
+			}
+			else if constexpr (freestanding::floating_point<T>) {
+				if (first != last && *first == '+') ++first;
+				auto [ptr, ec] { std::from_chars(first, last, result) };
+				return ec == std::errc{ } && ptr == last;
+			}
+			else {
+				if (first != last && *first == '+') ++first;
+				double number{ };
+				auto [ptr, ec] { std::from_chars(first, last, number) };
+				if (ec != std::errc{ } || number < 0.0) return false;
+				while (ptr != last && IniBlank(*ptr)) ++ptr;
+				std::string_view unit{ ptr, last };
+				if constexpr (freestanding::same<T, IniSize>) {
+					double scale{ };
+					if (unit.empty() || IniIEqual(unit, "b")) scale = 1.0;
+					else {
+						if (unit.size() > 1ULL && (unit.back() == 'b' || unit.back() == 'B')) unit.remove_suffix(1ULL);
+						if (unit.size() > 1ULL && unit.back() == 'i') unit.remove_suffix(1ULL);
+						if (IniIEqual(unit, "k")) scale = 1024.0;
+						else if (IniIEqual(unit, "m")) scale = 1048576.0;
+						else if (IniIEqual(unit, "g")) scale = 1073741824.0;
+						else if (IniIEqual(unit, "t")) scale = 1099511627776.0;
+						else return false;
+					}
+					if (number * scale >= 18446744073709551616.0) return false;
+					result.bytes = static_cast<mqui64>(number * scale);
+				}
+				else { // ޵λʱTĵλ
+					using namespace std::chrono;
+					if (unit.empty()) result = duration_cast<T>(duration<double, typename T::period>(number));
+					else if (unit == "ns") result = duration_cast<T>(duration<double, std::nano>(number));
+					else if (unit == "us") result = duration_cast<T>(duration<double, std::micro>(number));
+					else if (unit == "ms") result = duration_cast<T>(duration<double, std::milli>(number));
+					else if (unit == "s") result = duration_cast<T>(duration<double>(number));
+					else if (unit == "m" || unit == "min") result = duration_cast<T>(duration<double, std::ratio<60>>(number));
+					else if (unit == "h") result = duration_cast<T>(duration<double, std::ratio<3600>>(number));
+					else if (unit == "d") result = duration_cast<T>(duration<double, std::ratio<86400>>(number));
+					else return false;
+				}
+				return true;
+			}
+		}
+	}
+
+	/// <summary>
+	/// <para>ͼеֱֵӵַͼʹ</para>
+	/// <para>һֻдһεĽ棬׸getĿɻռã֮ͬ͵getֱȡ棬</para>
+	/// </summary>
+	export template<details::ini_char Char>
+	struct BasicIniValue : std::basic_string_view<Char> {
+		using StringViewT = std::basic_string_view<Char>;
+	protected:
+		mutable std::atomic<mqbyte> tag{ };
+		mutable mqui64 bits{ };
+	public:
+		BasicIniValue() = default;
+
+		BasicIniValue(StringViewT value) noexcept : StringViewT{ value } { }
+
+		BasicIniValue(BasicIniValue const& value) noexcept : StringViewT{ value } { }
+
+		BasicIniValue& operator = (BasicIniValue const& value) noexcept {
+			StringViewT::operator = (value);
+			tag.store(details::IniCacheEmpty, std::memory_order_relaxed);
+			return *this;
+		}
+
+		/// <summary>
+		/// Ϊboolstd::chrono::durationIniSize
+		/// </summary>
+		/// <param name="result">ʧʱ</param>
+		/// <returns>Ƿɹ</returns>
+		template<details::ini_value T, bool Cache = true>
+		bool parse(T& result) const noexcept {
+			if constexpr (Cache && details::ini_cacheable<T>) {
+				auto current{ tag.load(std::memory_order_acquire) };
+				if (current == details::IniCacheId<T>()) {
+					freestanding::copy(&result, &bits, sizeof(T));
+					return true;
+				}
+				T value{ };
+				if (!details::IniParseValue(StringViewT{ *this }, value)) return false;
+				if (current == details::IniCacheEmpty && tag.compare_exchange_strong(current, details::IniCacheBusy, std::memory_order_relaxed)) {
+					freestanding::copy(&bits, &value, sizeof(T));
+					tag.store(details::IniCacheId<T>(), std::memory_order_release);
+				}
+				result = value;
+				return true;
+			}
+			else { // from_charsں׺Ƿʱдǰ׺ֵȽֲ
+				T value{ };
+				if (!details::IniParseValue(StringViewT{ *this }, value)) return false;
+				result = value;
+				return true;
+			}
+		}
+	};
+
+	export template<details::ini_char Char>
+	struct BasicIniView;
 
 	// ͼ
-	export struct SectionView : protected std::unordered_map<std::wstring_view, std::wstring_view> {
-		friend struct IniView;
-		using BaseT = std::unordered_map<std::wstring_view, std::wstring_view>;
+	export template<details::ini_char Char>
+	struct BasicSectionView : protected std::unordered_map<std::basic_string_view<Char>, BasicIniValue<Char>> {
+		friend struct BasicIniView<Char>;
+		using StringViewT = std::basic_string_view<Char>;
+		using BaseT = std::unordered_map<StringViewT, BasicIniValue<Char>>;
 		using BaseT::empty;
 		using BaseT::size;
 		using BaseT::contains;
@@ -75,37 +445,45 @@ namespace MasterQian::Parser {
 			return BaseT::end();
 		}
 
-		[[nodiscard]] std::wstring_view operator [] (std::wstring_view key) const noexcept {
-			if (auto iter{ find(key) }; iter != cend()) {
+		[[nodiscard]] StringViewT operator [] (StringViewT key) const noexcept {
+			if (auto iter{ BaseT::find(key) }; iter != BaseT::cend()) {
 				return iter->second;
 			}
 			return { };
 		}
+
+		/// <summary>
+		/// ȡͻֵͬһظȡʱʹý
+		/// </summary>
+		/// <param name="key"></param>
+		/// <param name="default_value">ڻʧʱĬֵ</param>
+		template<details::ini_value T, bool Cache = true>
+		[[nodiscard]] T get(StringViewT key, T default_value = { }) const noexcept {
+			if (auto iter{ BaseT::find(key) }; iter != BaseT::cend()) {
+				iter->second.template parse<T, Cache>(default_value);
+			}
+			return default_value;
+		}
 	};
 
-	// iniͼ
-	export struct IniView : protected std::unordered_map<std::wstring_view, SectionView> {
+	/// <summary>
+	/// <para>iniͼ͵ؽⲿֵԭҲת</para>
+	/// <para>CharΪcharchar8_tʱֱڴӳUTF-8ļͼڼ仺뱣Ч</para>
+	/// </summary>
+	export template<details::ini_char Char>
+	struct BasicIniView : protected std::unordered_map<std::basic_string_view<Char>, BasicSectionView<Char>> {
 	protected:
-		using BaseT = std::unordered_map<std::wstring_view, SectionView>;
-
-		std::wstring content;
-		
-		inline static SectionView _empty_section{ };
+		using StringViewT = std::basic_string_view<Char>;
+		using BaseT = std::unordered_map<StringViewT, BasicSectionView<Char>>;
 
-		void _clear() noexcept {
-			clear();
-			content.clear();
-		}
+		inline static BasicSectionView<Char> const _empty_section{ };
 	public:
-		IniView() = default;
+		BasicIniView() = default;
 
-		IniView(std::wstring_view data) noexcept {
+		BasicIniView(StringViewT data) noexcept {
 			Load(data);
 		}
 
-		IniView(IniView const&) = delete;
-		IniView& operator = (IniView const&) = delete;
-
 		using BaseT::empty;
 		using BaseT::size;
 		using BaseT::contains;
@@ -118,68 +496,65 @@ namespace MasterQian::Parser {
 			return BaseT::end();
 		}
 
-		[[nodiscard]] SectionView const& operator[](std::wstring_view sv) const noexcept {
-			if (auto iter{ find(sv) }; iter != cend()) {
+		[[nodiscard]] BasicSectionView<Char> const& operator[](StringViewT sv) const noexcept {
+			if (auto iter{ BaseT::find(sv) }; iter != BaseT::cend()) {
 				return iter->second;
 			}
 			return _empty_section;
 		}
 
+		/// <summary>
+		/// ͵룬ı
+		/// </summary>
+		/// <param name="data">iniıͼڼ뱣Ч</param>
+		IniError Load(StringViewT data) noexcept {
+			BaseT::clear();
+			BasicSectionView<Char>* curSection{ };
+			auto result{ details::IniParse<Char>(data, [&](StringViewT name) noexcept {
+				curSection = &BaseT::try_emplace(name).first->second; // ͬںϲ
+			}, [&](StringViewT key, StringViewT value) noexcept {
+				curSection->insert_or_assign(key, value); // ͬȡһ
+			}) };
+			if (result != IniError::OK) {
+				BaseT::clear();
+			}
+			return result;
+		}
+	};
+
+	// UTF-8 iniͼ
+	export using IniViewA = BasicIniView<char>;
+	export using IniViewU8 = BasicIniView<char8_t>;
+
+	// ַͼ
+	export using SectionView = BasicSectionView<mqchar>;
+	export using IniValue = BasicIniValue<mqchar>;
+
+	// ַiniͼʱı
+	export struct IniView : public BasicIniView<mqchar> {
+	protected:
+		std::wstring content;
+	public:
+		IniView() = default;
+
+		IniView(std::wstring_view data) noexcept {
+			Load(data);
+		}
+
+		IniView(IniView const&) = delete;
+		IniView& operator = (IniView const&) = delete;
+
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="data">iniı</param>
 		IniError Load(std::wstring_view data) noexcept {
-			clear();
 			content = data;
-			SectionView* curSection{ };
-			mqcstr pData{ content.data() }, p1{ }, p2{ }, p3{ }, p4{ };
-			while (pData && *pData) {
-				pData = details::IniScanLine(pData, &p1, &p2, &p3, &p4);
-				if (pData) {
-					if (p3 && p4) { // 
-						if (curSection) { // ǰڴ
-							std::wstring_view key{ p1, p2 }, value{ p3, p4 };
-							if (key.empty()) {
-								_clear();
-								return IniError::EMPTY_KEY;
-							}
-							else {
-								if (auto iter{ curSection->find(key) }; iter != curSection->cend()) {
-									iter->second = value; // µǰ
-								}
-								else {
-									curSection->emplace(key, value); // 
-								}
-							}
-						}
-						else {
-							_clear();
-							return IniError::ISOLATED_ITEM;
-						}
-					}
-					else if (p1 && p2) { // 
-						if (std::wstring_view name{ p1, p2 }; !name.empty()) {
-							if (auto iter{ find(name) }; iter != cend()) { // µǰ
-								curSection = &iter->second;
-							}
-							else {
-								curSection = &emplace(name, SectionView{ }).first->second; // ½
-							}
-						}
-						else {
-							_clear();
-							return IniError::EMPTY_SECTION_NAME;
-						}
-					}
-					else { } // ע
-				}
-				else {
-					_clear();
-					return IniError::INVALID_LINE;
-				}
+			auto result{ BasicIniView<mqchar>::Load(content) };
+			if (result != IniError::OK) {
+				content.clear();
 			}
-			return IniError::OK;
+			return result;
 		}
 	};
 
@@ -188,6 +563,8 @@ namespace MasterQian::Parser {
 
 	// iniļ
 	export struct Ini : public std::unordered_map<std::wstring, Section, freestanding::isomerism_hash, freestanding::isomerism_equal> {
+		using BaseT = std::unordered_map<std::wstring, Section, freestanding::isomerism_hash, freestanding::isomerism_equal>;
+
 		Ini() = default;
 
 		Ini(std::wstring_view data) noexcept {
@@ -201,50 +578,80 @@ namespace MasterQian::Parser {
 		IniError Load(std::wstring_view data) noexcept {
 			clear();
 			Section* curSection{ };
-			mqcstr pData{ data.data() }, p1{ }, p2{ }, p3{ }, p4{ };
-			while (pData && *pData) {
-				pData = details::IniScanLine(pData, &p1, &p2, &p3, &p4);
-				if (pData) {
-					if (p3 && p4) { // 
-						if (curSection) { // ǰڴ
-							std::wstring key{ p1, p2 }, value{ p3, p4 };
-							if (key.empty()) {
-								clear();
-								return IniError::EMPTY_KEY;
-							}
-							else {
-								if (auto iter{ curSection->find(key) }; iter != curSection->cend()) {
-									iter->second = value; // µǰ
-								}
-								else {
-									curSection->emplace(std::move(key), std::move(value)); // 
-								}
-							}
-						}
-						else {
-							clear();
-							return IniError::ISOLATED_ITEM;
-						}
+			auto result{ details::IniParse<mqchar>(data, [&](std::wstring_view name) noexcept {
+				curSection = &try_emplace(std::wstring(name)).first->second; // ͬںϲ
+			}, [&](std::wstring_view key, std::wstring_view value) noexcept {
+				curSection->insert_or_assign(std::wstring(key), std::wstring(value)); // ͬȡһ
+			}) };
+			if (result != IniError::OK) {
+				clear();
+			}
+			return result;
+		}
+
+		/// <summary>
+		/// 룬ֻڽезıβнԭ˳ϲ
+		/// εͬͬǰΣȡıȳֵһLoadͬ
+		/// </summary>
+		/// <param name="data">iniı</param>
+		/// <param name="threads">߳0ΪӲ</param>
+		IniError LoadParallel(std::wstring_view data, mqui32 threads = 0U) noexcept {
+			if (threads == 0U) {
+				threads = std::thread::hardware_concurrency();
+			}
+			if (auto limit{ data.size() / details::IniParallelSize }; limit < threads) {
+				threads = static_cast<mqui32>(limit);
+			}
+			if (threads <= 1U) {
+				return Load(data);
+			}
+			mqlist<mqui64> bounds(threads + 1ULL);
+			bounds.add(0ULL);
+			for (mqui64 i{ 1ULL }; i < threads; ++i) {
+				auto pos{ details::IniNextSection(data, std::max(i * (data.size() / threads), bounds.back())) };
+				if (pos == data.size()) break;
+				if (pos > bounds.back()) {
+					bounds.add(pos);
+				}
+			}
+			bounds.add(data.size());
+			auto count{ bounds.size() - 1ULL };
+			auto parts{ std::make_unique<Ini[]>(count) };
+			auto errors{ std::make_unique<IniError[]>(count) };
+			auto parse = [&](mqui64 i) noexcept {
+				errors[i] = parts[i].Load(data.substr(bounds[i], bounds[i + 1ULL] - bounds[i]));
+			};
+			auto workers{ std::make_unique<std::thread[]>(count) };
+			for (mqui64 i{ 1ULL }; i < count; ++i) {
+				workers[i] = std::thread(parse, i);
+			}
+			parse(0ULL);
+			for (mqui64 i{ 1ULL }; i < count; ++i) {
+				workers[i].join();
+			}
+			clear();
+			for (mqui64 i{ }; i < count; ++i) {
+				if (errors[i] != IniError::OK) {
+					return errors[i];
+				}
+			}
+			static_cast<BaseT&>(*this) = static_cast<BaseT&&>(parts[0]);
+			for (mqui64 i{ 1ULL }; i < count; ++i) {
+				auto& part{ parts[i] };
+				while (part.size()) {
+					auto node{ part.extract(part.begin()) };
+					if (auto iter{ find(node.key()) }; iter == end()) {
+						insert(static_cast<decltype(node)&&>(node));
 					}
-					else if (p1 && p2) { // 
-						if (std::wstring name{ p1, p2 }; !name.empty()) {
-							if (auto iter{ find(name) }; iter != cend()) { // µǰ
-								curSection = &iter->second;
-							}
-							else {
-								curSection = &emplace(std::move(name), Section{ }).first->second; // ½
+					else { // ͬںϲͬȡ
+						auto& sec{ node.mapped() };
+						while (sec.size()) {
+							auto item{ sec.extract(sec.begin()) };
+							if (auto result{ iter->second.insert(static_cast<decltype(item)&&>(item)) }; !result.inserted) {
+								result.position->second = static_cast<std::wstring&&>(result.node.mapped());
 							}
 						}
-						else {
-							clear();
-							return IniError::EMPTY_SECTION_NAME;
-						}
 					}
-					else { } // ע
-				}
-				else {
-					clear();
-					return IniError::INVALID_LINE;
 				}
 			}
 			return IniError::OK;
@@ -281,4 +688,590 @@ namespace MasterQian::Parser {
 			return buf;
 		}
 	};
-}
\ No newline at end of file
+
+	// iniĵ޸ģԭı[offset, offset + size)滻Ϊtext
+	export struct IniChange {
+		mqui64 offset;
+		mqui64 size;
+		std::wstring text;
+	};
+
+	/// <summary>
+	/// <para>iniĵԭ˳ڡע</para>
+	/// <para>޸ֻ¼Ӱ䣬changesذƫ滻Saveƴӽԭıδ޸ĵĲԭ</para>
+	/// <para>ԭ޸ֵ䣬뵽ڵһ֮׷ӵĩ</para>
+	/// </summary>
+	export struct IniDocument {
+	protected:
+		using IndexT = std::unordered_map<std::wstring, mqui64, freestanding::isomerism_hash, freestanding::isomerism_equal>;
+
+		struct Item {
+			mqui64 line; // еʼƫ
+			mqui64 lineEnd; // кеĽƫ
+			mqui64 keyBegin; // 䣬ʱkeyBeginΪtexts±
+			mqui64 keyEnd;
+			mqui64 valueBegin; // ֵ
+			mqui64 valueEnd;
+			mqui64 value; // ޸ĺֵtextsе± + 10Ϊδ޸
+			bool added; // 
+			bool removed; // ɾ
+		};
+
+		struct Sec {
+			std::wstring const* name;
+			mqlist<mqui64> headers; // γֵĽͷУ[begin, end)ɶԴ
+			mqlist<mqui64> items; // ĵ˳±
+			IndexT keys; //  -> һͬ
+			mqui64 tail; // Ĳλ
+			bool added; // ڣ׷ӵĩ
+			bool dropped; // ԭнɾ
+		};
+
+		std::wstring content;
+		std::unordered_map<std::wstring, Sec, freestanding::isomerism_hash, freestanding::isomerism_equal> secs;
+		mqlist<Sec*> order;
+		mqlist<Item> items;
+		mqlist<std::wstring> texts;
+		bool crlf{ };
+
+		[[nodiscard]] std::wstring_view _key(Item const& item) const noexcept {
+			if (item.added) return texts[item.keyBegin];
+			return std::wstring_view{ content }.substr(item.keyBegin, item.keyEnd - item.keyBegin);
+		}
+
+		[[nodiscard]] std::wstring_view _value(Item const& item) const noexcept {
+			if (item.value) return texts[item.value - 1ULL];
+			return std::wstring_view{ content }.substr(item.valueBegin, item.valueEnd - item.valueBegin);
+		}
+
+		[[nodiscard]] std::wstring_view _newline() const noexcept {
+			return crlf ? std::wstring_view{ L"\r\n", 2ULL } : std::wstring_view{ L"\n", 1ULL };
+		}
+
+		// ƫеʼ뺬еĽ
+		void _line(mqui64 begin, mqui64 end, mqui64& line, mqui64& lineEnd) const noexcept {
+			while (begin != 0ULL && !details::IniNewLine(content[begin - 1ULL])) --begin;
+			while (end != content.size() && !details::IniNewLine(content[end])) ++end;
+			if (end != content.size() && content[end] == L'\r') ++end;
+			if (end != content.size() && content[end] == L'\n') ++end;
+			line = begin;
+			lineEnd = end;
+		}
+
+		Sec& _section(std::wstring_view name) noexcept {
+			auto [iter, inserted] { secs.try_emplace(std::wstring(name)) };
+			if (inserted) {
+				iter->second.name = &iter->first;
+				order.add(&iter->second);
+			}
+			return iter->second;
+		}
+	public:
+		IniDocument() = default;
+
+		IniDocument(std::wstring_view data) noexcept {
+			Load(data);
+		}
+
+		IniDocument(IniDocument const&) = delete;
+		IniDocument& operator = (IniDocument const&) = delete;
+		IniDocument(IniDocument&&) = default;
+		IniDocument& operator = (IniDocument&&) = default;
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="data">iniı</param>
+		IniError Load(std::wstring_view data) noexcept {
+			secs.clear();
+			order.clear();
+			items.clear();
+			texts.clear();
+			content = data;
+			auto newline{ content.find(L'\n') };
+			crlf = newline != std::wstring::npos && newline != 0ULL && content[newline - 1ULL] == L'\r';
+			auto base{ content.data() };
+			Sec* curSection{ };
+			auto result{ details::IniParse<mqchar>(content, [&](std::wstring_view name) noexcept {
+				curSection = &_section(name); // ͬںϲ
+				mqui64 line{ }, lineEnd{ };
+				_line(static_cast<mqui64>(name.data() - base), static_cast<mqui64>(name.data() + name.size() - base), line, lineEnd);
+				curSection->headers.add(line);
+				curSection->headers.add(lineEnd);
+				curSection->tail = lineEnd;
+			}, [&](std::wstring_view key, std::wstring_view value) noexcept {
+				Item item{ };
+				item.keyBegin = static_cast<mqui64>(key.data() - base);
+				item.keyEnd = item.keyBegin + key.size();
+				item.valueBegin = static_cast<mqui64>(value.data() - base);
+				item.valueEnd = item.valueBegin + value.size();
+				_line(item.keyBegin, item.valueEnd, item.line, item.lineEnd);
+				curSection->keys.insert_or_assign(std::wstring(key), items.size()); // ͬȡһ
+				curSection->items.add(items.size());
+				curSection->tail = item.lineEnd;
+				items.add(item);
+			}) };
+			if (result != IniError::OK) {
+				secs.clear();
+				order.clear();
+				items.clear();
+				content.clear();
+			}
+			return result;
+		}
+
+		[[nodiscard]] bool contains(std::wstring_view section) const noexcept {
+			auto iter{ secs.find(section) };
+			return iter != secs.cend() && (iter->second.added || !iter->second.dropped);
+		}
+
+		[[nodiscard]] bool contains(std::wstring_view section, std::wstring_view key) const noexcept {
+			auto iter{ secs.find(section) };
+			return iter != secs.cend() && iter->second.keys.find(key) != iter->second.keys.cend();
+		}
+
+		/// <summary>
+		/// ȡֵ
+		/// </summary>
+		/// <param name="section"></param>
+		/// <param name="key"></param>
+		/// <returns>ֵʱΪգһ޸ǰЧ</returns>
+		[[nodiscard]] std::wstring_view get(std::wstring_view section, std::wstring_view key) const noexcept {
+			if (auto iter{ secs.find(section) }; iter != secs.cend()) {
+				if (auto it{ iter->second.keys.find(key) }; it != iter->second.keys.cend()) {
+					return _value(items[it->second]);
+				}
+			}
+			return { };
+		}
+
+		/// <summary>
+		/// ֵֻ滻ֵ䣬뵽ĩβ½׷ӵĩ
+		/// </summary>
+		/// <param name="section"></param>
+		/// <param name="key"></param>
+		/// <param name="value">ֵ</param>
+		void set(std::wstring_view section, std::wstring_view key, std::wstring_view value) noexcept {
+			auto& sec{ _section(section) };
+			if (sec.headers.size() == 0ULL || sec.dropped) {
+				sec.added = true;
+			}
+			if (auto iter{ sec.keys.find(key) }; iter != sec.keys.cend()) {
+				auto& item{ items[iter->second] };
+				if (item.value) {
+					texts[item.value - 1ULL] = value;
+				}
+				else {
+					texts.add(std::wstring(value));
+					item.value = texts.size();
+				}
+				return;
+			}
+			Item item{ };
+			item.added = true;
+			item.keyBegin = texts.size();
+			texts.add(std::wstring(key));
+			texts.add(std::wstring(value));
+			item.value = texts.size();
+			sec.keys.try_emplace(std::wstring(key), items.size());
+			sec.items.add(items.size());
+			items.add(item);
+		}
+
+		/// <summary>
+		/// ɾǵͬڵ
+		/// </summary>
+		/// <param name="section"></param>
+		/// <param name="key"></param>
+		/// <returns>Ƿ</returns>
+		bool remove(std::wstring_view section, std::wstring_view key) noexcept {
+			auto iter{ secs.find(section) };
+			if (iter == secs.end()) return false;
+			auto& sec{ iter->second };
+			auto it{ sec.keys.find(key) };
+			if (it == sec.keys.end()) return false;
+			sec.keys.erase(it);
+			for (auto index : sec.items) {
+				if (auto& item{ items[index] }; !item.removed && _key(item) == key) {
+					item.removed = true;
+				}
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// ɾڣγֵĽͷ
+		/// </summary>
+		/// <param name="section"></param>
+		/// <returns>Ƿ</returns>
+		bool remove(std::wstring_view section) noexcept {
+			auto iter{ secs.find(section) };
+			if (iter == secs.end() || !contains(section)) return false;
+			auto& sec{ iter->second };
+			for (auto index : sec.items) {
+				items[index].removed = true;
+			}
+			sec.keys.clear();
+			sec.dropped = true;
+			sec.added = false;
+			return true;
+		}
+
+		/// <summary>
+		/// ĵ˳ö
+		/// </summary>
+		/// <param name="func">صΪֵ</param>
+		template<typename Func>
+		void enumerate(Func&& func) const noexcept {
+			for (auto sec : order) {
+				for (auto index : sec->items) {
+					if (auto& item{ items[index] }; !item.removed) {
+						func(std::wstring_view{ *sec->name }, _key(item), _value(item));
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// ı޸ģ(ƫ, )ͬƫƵĲ滻֮ǰȺص޸ĺϲΪһ
+		/// </summary>
+		[[nodiscard]] mqlist<IniChange> changes() const noexcept {
+			mqlist<IniChange> result;
+			auto newline{ _newline() };
+			bool eofNewline{ content.empty() || details::IniNewLine(content.back()) }; // ĩǰǷҪ
+			auto insert = [&](mqui64 offset, std::wstring text) noexcept {
+				if (offset == content.size() && !eofNewline) {
+					text.insert(0ULL, newline);
+					eofNewline = true;
+				}
+				result.add(IniChange{ offset, 0ULL, static_cast<std::wstring&&>(text) });
+			};
+			std::wstring appended;
+			for (auto sec : order) {
+				if (sec->dropped) {
+					for (mqui64 i{ }; i < sec->headers.size(); i += 2ULL) {
+						result.add(IniChange{ sec->headers[i], sec->headers[i + 1ULL] - sec->headers[i], { } });
+					}
+				}
+				std::wstring inserted;
+				for (auto index : sec->items) {
+					auto& item{ items[index] };
+					if (item.added) {
+						if (!item.removed) {
+							inserted += _key(item);
+							inserted.push_back(L'=');
+							inserted += _value(item);
+							inserted += newline;
+						}
+					}
+					else if (item.removed) {
+						result.add(IniChange{ item.line, item.lineEnd - item.line, { } });
+					}
+					else if (item.value) {
+						result.add(IniChange{ item.valueBegin, item.valueEnd - item.valueBegin, texts[item.value - 1ULL] });
+					}
+				}
+				if (inserted.empty()) continue;
+				if (sec->added) {
+					appended.push_back(L'[');
+					appended += *sec->name;
+					appended.push_back(L']');
+					appended += newline;
+					appended += inserted;
+				}
+				else {
+					insert(sec->tail, static_cast<std::wstring&&>(inserted));
+				}
+			}
+			std::stable_sort(result.begin(), result.end(), [](IniChange const& a, IniChange const& b) noexcept {
+				if (a.offset != b.offset) return a.offset < b.offset;
+				return a.offset + a.size < b.offset + b.size;
+			});
+			mqlist<IniChange> merged;
+			merged.reserve(result.size());
+			for (auto& change : result) {
+				// ǰһصʱϲΪߵһ滻ıȺƴ
+				if (merged.size() != 0ULL) {
+					if (auto& last{ merged.back() }; change.offset < last.offset + last.size) {
+						last.size = std::max(last.offset + last.size, change.offset + change.size) - last.offset;
+						last.text += change.text;
+						continue;
+					}
+				}
+				merged.add(static_cast<IniChange&&>(change));
+			}
+			result = static_cast<mqlist<IniChange>&&>(merged);
+			if (!appended.empty()) {
+				insert(content.size(), static_cast<std::wstring&&>(appended));
+			}
+			return result;
+		}
+
+		/// <summary>
+		/// 棬޸ƴӽԭı
+		/// </summary>
+		/// <returns>iniı</returns>
+		[[nodiscard]] std::wstring Save() const noexcept {
+			auto list{ changes() };
+			mqui64 totalSize{ content.size() };
+			for (auto& change : list) {
+				totalSize = totalSize - change.size + change.text.size();
+			}
+			std::wstring buf;
+			buf.reserve(totalSize);
+			mqui64 pos{ };
+			for (auto& change : list) {
+				buf.append(content, pos, change.offset - pos);
+				buf += change.text;
+				pos = change.offset + change.size;
+			}
+			buf.append(content, pos);
+			return buf;
+		}
+	};
+
+	// iniı仯
+	export enum class IniChangeType : mqenum {
+		ADDED, // 
+		MODIFIED, // ޸
+		REMOVED // ɾ
+	};
+
+	// iniı仯ͼڻصڼЧ
+	export struct IniChangeEvent {
+		IniChangeType type;
+		std::wstring_view section;
+		std::wstring_view key;
+		std::wstring_view old_value; // ʱΪ
+		std::wstring_view new_value; // ɾʱΪ
+	};
+
+	/// <summary>
+	/// Ƚiniÿ޸ġɾfunc(IniChangeEvent const&)
+	/// </summary>
+	/// <param name="old_ini">ini</param>
+	/// <param name="new_ini">ini</param>
+	/// <param name="func">ص</param>
+	export template<typename Func>
+	void IniDiff(Ini const& old_ini, Ini const& new_ini, Func&& func) noexcept {
+		for (auto& [name, sec] : old_ini) {
+			auto iter{ new_ini.find(name) };
+			for (auto& [key, value] : sec) {
+				if (iter == new_ini.cend()) {
+					func(IniChangeEvent{ IniChangeType::REMOVED, name, key, value, { } });
+				}
+				else if (auto it{ iter->second.find(key) }; it == iter->second.cend()) {
+					func(IniChangeEvent{ IniChangeType::REMOVED, name, key, value, { } });
+				}
+				else if (it->second != value) {
+					func(IniChangeEvent{ IniChangeType::MODIFIED, name, key, value, it->second });
+				}
+			}
+		}
+		for (auto& [name, sec] : new_ini) {
+			auto iter{ old_ini.find(name) };
+			for (auto& [key, value] : sec) {
+				if (iter == old_ini.cend() || !iter->second.contains(key)) {
+					func(IniChangeEvent{ IniChangeType::ADDED, name, key, { }, value });
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// iniӻصڼ߳е
+	/// </summary>
+	/// <param name="arg">Я</param>
+	/// <param name="change">ı仯</param>
+	export using IniWatchCallBack = void(__stdcall*)(mqmem, IniChangeEvent const&);
+
+	namespace details {
+		struct IniOverlapped {
+			mqui64 internal;
+			mqui64 internalHigh;
+			mqui64 offset;
+			mqhandle event;
+		};
+
+		inline bool IniReadFile(std::wstring const& path, std::string& bytes) noexcept {
+			auto handle{ api::CreateFileW(path.data(), 0x80000000U, 0x7U, nullptr, 3U, 0x80U, nullptr) };
+			if (handle == reinterpret_cast<mqhandle>(-1LL)) return false;
+			mqi64 size{ };
+			bool ok{ api::GetFileSizeEx(handle, &size) && size >= 0LL && size <= 0xFFFFFFFFLL };
+			if (ok) {
+				bytes.resize(static_cast<mqui64>(size));
+				mqui32 read{ };
+				ok = size == 0LL || (api::ReadFile(handle, bytes.data(), static_cast<mqui32>(size), &read, nullptr) && read == static_cast<mqui32>(size));
+			}
+			api::CloseHandle(handle);
+			return ok;
+		}
+
+		// UTF-16LE(BOM)UTF-8תΪַ
+		inline std::wstring IniDecode(std::string_view bytes) noexcept {
+			std::wstring text;
+			if (bytes.size() >= 2ULL && static_cast<mqbyte>(bytes[0]) == 0xFFU && static_cast<mqbyte>(bytes[1]) == 0xFEU) {
+				text.resize((bytes.size() - 2ULL) / sizeof(mqchar));
+				freestanding::copy(text.data(), bytes.data() + 2ULL, text.size() * sizeof(mqchar));
+			}
+			else if (auto len{ api::MultiByteToWideChar(65001U, 0U, bytes.data(), static_cast<mqi32>(bytes.size()), nullptr, 0) }; len > 0) {
+				text.resize(static_cast<mqui64>(len));
+				api::MultiByteToWideChar(65001U, 0U, bytes.data(), static_cast<mqi32>(bytes.size()), text.data(), len);
+			}
+			return text;
+		}
+	}
+
+	/// <summary>
+	/// <para>iniļӣͨReadDirectoryChangesWȴĿ¼ı仯ļݸıʱ½</para>
+	/// <para>ԭӵ滻ղ汾ţȽ¾ɿղصʧʱɿ</para>
+	/// <para>snapshotزɱĿգȡڼ䲻Ӱ죬</para>
+	/// </summary>
+	export struct IniWatcher {
+	protected:
+		std::wstring path;
+		std::wstring name;
+		std::atomic<std::shared_ptr<Ini const>> current;
+		std::atomic<mqui64> version{ };
+		IniWatchCallBack callback{ };
+		mqmem arg{ };
+		mqhandle directory{ };
+		mqhandle changed{ };
+		mqhandle stopped{ };
+		mqui64 digest{ }; // ļݹϣ
+		std::thread worker;
+
+		bool _reload() noexcept {
+			std::string bytes;
+			if (!details::IniReadFile(path, bytes)) return false;
+			auto hash{ freestanding::hash_bytes(reinterpret_cast<mqcbytes>(bytes.data()), bytes.size()) };
+			if (hash == digest && version.load(std::memory_order_relaxed)) return true; // δ
+			auto ini{ std::make_shared<Ini>() };
+			if (ini->Load(details::IniDecode(bytes)) != IniError::OK) return false;
+			digest = hash;
+			// ȷ¿汾ţصжȡsnapshot/versionΪݣɿoldеȽϽ
+			std::shared_ptr<Ini const> fresh{ static_cast<std::shared_ptr<Ini>&&>(ini) };
+			auto old{ current.load(std::memory_order_acquire) }; // ֻм߳滻
+			current.store(fresh, std::memory_order_release);
+			version.fetch_add(1ULL, std::memory_order_release);
+			if (callback && old) {
+				IniDiff(*old, *fresh, [this](IniChangeEvent const& change) noexcept {
+					callback(arg, change);
+				});
+			}
+			return true;
+		}
+
+		void _run() noexcept {
+			alignas(8) mqbyte buffer[16384];
+			details::IniOverlapped overlapped{ };
+			overlapped.event = changed;
+			mqhandle events[2]{ changed, stopped };
+			for (;;) {
+				if (!api::ReadDirectoryChangesW(directory, buffer, sizeof(buffer), false, 0x19U, nullptr, &overlapped, nullptr)) break;
+				mqui32 bytes{ };
+				if (api::WaitForMultipleObjects(2U, events, false, 0xFFFFFFFFU) != 0U) {
+					api::CancelIoEx(directory, &overlapped);
+					api::GetOverlappedResult(directory, &overlapped, &bytes, true);
+					break;
+				}
+				if (!api::GetOverlappedResult(directory, &overlapped, &bytes, false)) break;
+				bool hit{ bytes == 0U }; // ʱ޷֪ļ
+				for (mqui64 offset{ }; !hit && offset + 12ULL <= bytes; ) {
+					mqui32 record[3]; // NextEntryOffset, Action, FileNameLength
+					freestanding::copy(record, buffer + offset, sizeof(record));
+					std::wstring fn(reinterpret_cast<mqcstr>(buffer + offset + 12ULL), record[2] / sizeof(mqchar));
+					// ½޸
+					if ((record[1] == 1U || record[1] == 3U || record[1] == 5U) && api::lstrcmpiW(fn.data(), name.data()) == 0) {
+						hit = true;
+					}
+					if (record[0] == 0U) break;
+					offset += record[0];
+				}
+				if (!hit) continue;
+				// д뷽ռļδд꣬Ժ
+				for (mqui32 retry{ }; retry < 10U; ++retry) {
+					if (api::WaitForSingleObject(stopped, 50U) == 0U) return;
+					if (_reload()) break;
+				}
+			}
+		}
+
+		void _close() noexcept {
+			for (auto handle : { &directory, &changed, &stopped }) {
+				if (*handle) {
+					api::CloseHandle(*handle);
+					*handle = nullptr;
+				}
+			}
+		}
+	public:
+		IniWatcher() = default;
+
+		IniWatcher(IniWatcher const&) = delete;
+		IniWatcher& operator = (IniWatcher const&) = delete;
+
+		~IniWatcher() noexcept {
+			stop();
+		}
+
+		/// <summary>
+		/// ļʼ
+		/// </summary>
+		/// <param name="fn">ļ</param>
+		/// <param name="cb">仯ص</param>
+		/// <param name="a">Я</param>
+		/// <returns>״Ƿɹ</returns>
+		bool start(std::wstring_view fn, IniWatchCallBack cb = nullptr, mqmem a = nullptr) noexcept {
+			stop();
+			path = fn;
+			auto pos{ path.find_last_of(L"\\/") };
+			std::wstring folder{ pos == std::wstring::npos ? std::wstring(L".") : path.substr(0ULL, pos) };
+			name = pos == std::wstring::npos ? path : path.substr(pos + 1ULL);
+			callback = cb;
+			arg = a;
+			digest = 0ULL;
+			version.store(0ULL, std::memory_order_relaxed);
+			current.store(nullptr, std::memory_order_relaxed);
+			if (!_reload()) return false;
+			directory = api::CreateFileW(folder.data(), 0x1U, 0x7U, nullptr, 3U, 0x42000000U, nullptr); // FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED
+			if (directory == reinterpret_cast<mqhandle>(-1LL)) {
+				directory = nullptr;
+				return false;
+			}
+			changed = api::CreateEventW(nullptr, true, false, nullptr);
+			stopped = api::CreateEventW(nullptr, true, false, nullptr);
+			if (!changed || !stopped) {
+				_close();
+				return false;
+			}
+			worker = std::thread(&IniWatcher::_run, this);
+			return true;
+		}
+
+		/// <summary>
+		/// ֹͣӣĿ
+		/// </summary>
+		void stop() noexcept {
+			if (worker.joinable()) {
+				api::SetEvent(stopped);
+				worker.join();
+			}
+			_close();
+		}
+
+		/// <summary>
+		/// ǰգδʱΪ
+		/// </summary>
+		[[nodiscard]] std::shared_ptr<Ini const> snapshot() const noexcept {
+			return current.load(std::memory_order_acquire);
+		}
+
+		/// <summary>
+		/// Ĵÿ滻պһ
+		/// </summary>
+		[[nodiscard]] mqui64 generation() const noexcept {
+			return version.load(std::memory_order_acquire);
+		}
+	};
+}
@@ -0,0 +1,1233 @@
+#pragma once
+
+// ʱݿ⣬TimeZoneDatabase::CompileIANA tzdata 2025b(ziczoneinfoļ)ɣֹ޸
+// tzdataʱʱ
+// America/Chicago America/Denver America/Los_Angeles America/New_York America/Sao_Paulo
+// Asia/Dubai Asia/Hong_Kong Asia/Kolkata Asia/Seoul Asia/Shanghai Asia/Singapore Asia/Taipei Asia/Tokyo
+// Australia/Sydney Europe/Berlin Europe/London Europe/Moscow Europe/Paris UTC
+namespace MasterQian::details {
+	alignas(8) inline constexpr unsigned char TimeZoneData[]{
+		0x4D, 0x51, 0x54, 0x5A, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x01, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0xCA, 0x08, 0x00, 0x00,
+		0x4F, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x08, 0x0B, 0x00, 0x00, 0xF4, 0x05, 0x00, 0x00,
+		0x5D, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0xF0, 0x06, 0x00, 0x00,
+		0x70, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF0, 0x17, 0x00, 0x00, 0xB2, 0x08, 0x00, 0x00,
+		0x80, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xA8, 0x20, 0x00, 0x00, 0x6E, 0x03, 0x00, 0x00,
+		0x91, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+		0x9B, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x58, 0x24, 0x00, 0x00, 0xDA, 0x02, 0x00, 0x00,
+		0xA9, 0x01, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x38, 0x27, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00,
+		0xB5, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xC8, 0x27, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00,
+		0xBF, 0x01, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x30, 0x29, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00,
+		0xCC, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x68, 0x2A, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+		0xDA, 0x01, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x28, 0x2B, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00,
+		0xE5, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xE8, 0x2C, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00,
+		0xEF, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00,
+		0xFF, 0x01, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0xD0, 0x32, 0x00, 0x00, 0x95, 0x05, 0x00, 0x00,
+		0x0C, 0x02, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x68, 0x38, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00,
+		0x19, 0x02, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x97, 0x03, 0x00, 0x00,
+		0x26, 0x02, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x45, 0x00, 0x00, 0x36, 0x07, 0x00, 0x00,
+		0x32, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x4C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+		0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2F, 0x43, 0x68, 0x69, 0x63, 0x61, 0x67, 0x6F, 0x41,
+		0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2F, 0x44, 0x65, 0x6E, 0x76, 0x65, 0x72, 0x41, 0x6D, 0x65,
+		0x72, 0x69, 0x63, 0x61, 0x2F, 0x4C, 0x6F, 0x73, 0x5F, 0x41, 0x6E, 0x67, 0x65, 0x6C, 0x65, 0x73,
+		0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2F, 0x4E, 0x65, 0x77, 0x5F, 0x59, 0x6F, 0x72, 0x6B,
+		0x41, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2F, 0x53, 0x61, 0x6F, 0x5F, 0x50, 0x61, 0x75, 0x6C,
+		0x6F, 0x41, 0x73, 0x69, 0x61, 0x2F, 0x44, 0x75, 0x62, 0x61, 0x69, 0x41, 0x73, 0x69, 0x61, 0x2F,
+		0x48, 0x6F, 0x6E, 0x67, 0x5F, 0x4B, 0x6F, 0x6E, 0x67, 0x41, 0x73, 0x69, 0x61, 0x2F, 0x4B, 0x6F,
+		0x6C, 0x6B, 0x61, 0x74, 0x61, 0x41, 0x73, 0x69, 0x61, 0x2F, 0x53, 0x65, 0x6F, 0x75, 0x6C, 0x41,
+		0x73, 0x69, 0x61, 0x2F, 0x53, 0x68, 0x61, 0x6E, 0x67, 0x68, 0x61, 0x69, 0x41, 0x73, 0x69, 0x61,
+		0x2F, 0x53, 0x69, 0x6E, 0x67, 0x61, 0x70, 0x6F, 0x72, 0x65, 0x41, 0x73, 0x69, 0x61, 0x2F, 0x54,
+		0x61, 0x69, 0x70, 0x65, 0x69, 0x41, 0x73, 0x69, 0x61, 0x2F, 0x54, 0x6F, 0x6B, 0x79, 0x6F, 0x41,
+		0x75, 0x73, 0x74, 0x72, 0x61, 0x6C, 0x69, 0x61, 0x2F, 0x53, 0x79, 0x64, 0x6E, 0x65, 0x79, 0x45,
+		0x75, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x42, 0x65, 0x72, 0x6C, 0x69, 0x6E, 0x45, 0x75, 0x72, 0x6F,
+		0x70, 0x65, 0x2F, 0x4C, 0x6F, 0x6E, 0x64, 0x6F, 0x6E, 0x45, 0x75, 0x72, 0x6F, 0x70, 0x65, 0x2F,
+		0x4D, 0x6F, 0x73, 0x63, 0x6F, 0x77, 0x45, 0x75, 0x72, 0x6F, 0x70, 0x65, 0x2F, 0x50, 0x61, 0x72,
+		0x69, 0x73, 0x55, 0x54, 0x43, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x08, 0x00, 0x16, 0x00,
+		0xA0, 0xFE, 0x03, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2C, 0xA6, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xF9, 0xBA, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0x86, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xDB, 0x9A, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x74, 0xCB, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xF7, 0x83, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xD2, 0x45, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xD9, 0x63, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xD9, 0x53, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x97, 0x15, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBB, 0x33, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xB3, 0xFE, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x9D, 0x13, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x95, 0xDE, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF3, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x77, 0xBE, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x61, 0xD3, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x59, 0x9E, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x43, 0xB3, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x3B, 0x7E, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0x9C, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x58, 0x67, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x41, 0x7C, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x3A, 0x47, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x23, 0x5C, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x1C, 0x27, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0x3C, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xFE, 0x06, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xE7, 0x1B, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xE0, 0xE6, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x05, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xC2, 0xC6, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE6, 0xE4, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xDE, 0xAF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC8, 0xC4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xC0, 0x8F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xD6, 0x5A, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x3C, 0xB0, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x8C, 0x84, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x84, 0x4F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x6E, 0x64, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x66, 0x2F, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x8A, 0x4D, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x48, 0x0F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x6C, 0x2D, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x65, 0xF8, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4E, 0x0D, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x47, 0xD8, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x88, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xF4, 0x23, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x09, 0x61, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0xF3, 0x75, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xEB, 0x40, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0xD5, 0x55, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xCD, 0x20, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0xB7, 0x35, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAF, 0x00, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x99, 0x15, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x91, 0xE0, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xB5, 0xFE, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x73, 0xC0, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x97, 0xDE, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x90, 0xA9, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x79, 0xBE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x72, 0x89, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x5B, 0x9E, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x54, 0x69, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x3D, 0x7E, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x36, 0x49, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x1F, 0x5E, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3C, 0x57, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x3C, 0x47, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x37, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x1E, 0x27, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x17, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x00, 0x07, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE2, 0xF6, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0xE2, 0xE6, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC4, 0xD6, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0xC4, 0xC6, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xE1, 0xBF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xE0, 0xAF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xC3, 0x9F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xC2, 0x8F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xA5, 0x7F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xA4, 0x6F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x87, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x86, 0x4F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x69, 0x3F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x68, 0x2F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x85, 0x28, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x4A, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x67, 0x08, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x67, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x49, 0xE8, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x49, 0xD8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2B, 0xC8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x2B, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0D, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x0D, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xEF, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xEF, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x71, 0x03, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x0B, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0xEE, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xED, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x70, 0xD0, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x27, 0x8D, 0x07, 0x00, 0x00, 0x00, 0x00, 0x70, 0xB2, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xA3, 0xAD, 0x09, 0x00, 0x00, 0x00, 0x00, 0x70, 0x94, 0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x93, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB0, 0xD9, 0x0C, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x75, 0xC0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x92, 0xB9, 0x0E, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x92, 0xA9, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x74, 0x99, 0x10, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x74, 0x89, 0x11, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x56, 0x79, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x56, 0x69, 0x13, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x38, 0x59, 0x14, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x38, 0x49, 0x15, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1A, 0x39, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x1A, 0x29, 0x17, 0x00, 0x00, 0x00, 0x00, 0x70, 0x37, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFC, 0x08, 0x19, 0x00, 0x00, 0x00, 0x00, 0x70, 0x19, 0x02, 0x1A, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x18, 0xF2, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFB, 0xE1, 0x1B, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xFA, 0xD1, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x70, 0xDD, 0xC1, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xDC, 0xB1, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x70, 0xBF, 0xA1, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0x76, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA1, 0x81, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xF1, 0x55, 0x22, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBD, 0x6A, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xD3, 0x35, 0x24, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9F, 0x4A, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xB5, 0x15, 0x26, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x81, 0x2A, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xD1, 0xFE, 0x27, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x63, 0x0A, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xB3, 0xDE, 0x29, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x45, 0xEA, 0x2A, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x95, 0xBE, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x70, 0x62, 0xD3, 0x2C, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x77, 0x9E, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x70, 0x44, 0xB3, 0x2E, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x59, 0x7E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x26, 0x93, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x76, 0x67, 0x31, 0x00, 0x00, 0x00, 0x00, 0x70, 0x08, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x58, 0x47, 0x33, 0x00, 0x00, 0x00, 0x00, 0x70, 0xEA, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x3A, 0x27, 0x35, 0x00, 0x00, 0x00, 0x00, 0x70, 0xCC, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x1C, 0x07, 0x37, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE8, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFE, 0xE6, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xCA, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xE0, 0xC6, 0x3A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xAC, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xFC, 0xAF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x8E, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xDE, 0x8F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xC0, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x70, 0x8D, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xA2, 0x4F, 0x42, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6F, 0x64, 0x43, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x84, 0x2F, 0x44, 0x00, 0x00, 0x00, 0x00, 0x70, 0x51, 0x44, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xB7, 0xF3, 0x45, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6D, 0x2D, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x99, 0xD3, 0x47, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x4F, 0x0D, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x7B, 0xB3, 0x49, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x31, 0xED, 0x4A, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x97, 0x9C, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x70, 0x4E, 0xD6, 0x4C, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x79, 0x7C, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0xB6, 0x4E, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x5B, 0x5C, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x12, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x3D, 0x3C, 0x51, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF4, 0x75, 0x52, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x1F, 0x1C, 0x53, 0x00, 0x00, 0x00, 0x00, 0x70, 0xD6, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x01, 0xFC, 0x54, 0x00, 0x00, 0x00, 0x00, 0x70, 0xB8, 0x35, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x1E, 0xE5, 0x56, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xD4, 0x1E, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xC5, 0x58, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB6, 0xFE, 0x59, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xE2, 0xA4, 0x5A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x98, 0xDE, 0x5B, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xC4, 0x84, 0x5C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7A, 0xBE, 0x5D, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xA6, 0x64, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x5C, 0x9E, 0x5F, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xC2, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00, 0x70, 0x79, 0x87, 0x61, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xA4, 0x2D, 0x62, 0x00, 0x00, 0x00, 0x00, 0x70, 0x5B, 0x67, 0x63, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x86, 0x0D, 0x64, 0x00, 0x00, 0x00, 0x00, 0x70, 0x3D, 0x47, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x68, 0xED, 0x65, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1F, 0x27, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x4A, 0xCD, 0x67, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0x07, 0x69, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x2C, 0xAD, 0x69, 0x00, 0x00, 0x00, 0x00, 0x70, 0xE3, 0xE6, 0x6A, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x49, 0x96, 0x6B, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xCF, 0x6C, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x2B, 0x76, 0x6D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE1, 0xAF, 0x6E, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0D, 0x56, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC3, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xEF, 0x35, 0x71, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xA5, 0x6F, 0x72, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xD1, 0x15, 0x73, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x87, 0x4F, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xED, 0xFE, 0x74, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA4, 0x38, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xCF, 0xDE, 0x76, 0x00, 0x00, 0x00, 0x00, 0x70, 0x86, 0x18, 0x78, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xB1, 0xBE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x70, 0x68, 0xF8, 0x79, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x93, 0x9E, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x70, 0x4A, 0xD8, 0x7B, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x75, 0x7E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2C, 0xB8, 0x7D, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x57, 0x5E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x98, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0xD4, 0xAD, 0xFF, 0xFF, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xB9, 0xFF, 0xFF,
+		0x01, 0x43, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAB, 0xFF, 0xFF, 0x00, 0x43, 0x53, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0xA0, 0xAB, 0xFF, 0xFF, 0x00, 0x43, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0xB0, 0xB9, 0xFF, 0xFF, 0x00, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xB9, 0xFF, 0xFF,
+		0x01, 0x43, 0x57, 0x54, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xB9, 0xFF, 0xFF, 0x01, 0x43, 0x50, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0xA0, 0xAB, 0xFF, 0xFF, 0x00, 0x43, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x05, 0x06, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x43, 0x53, 0x54, 0x36,
+		0x43, 0x44, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x32, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x31, 0x2E, 0x31,
+		0x2E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00,
+		0xB0, 0x0C, 0x04, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x3A, 0xA6, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x07, 0xBB, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x1C, 0x86, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xE9, 0x9A, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xFE, 0x65, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x06, 0x84, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xE0, 0x45, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xA6, 0x8F, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x0C, 0x89, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xF4, 0x23, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x18, 0x61, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x76, 0x2F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x94, 0x28, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x58, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x76, 0x08, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x75, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x58, 0xE8, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x57, 0xD8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3A, 0xC8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x39, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1C, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x1B, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xFD, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1A, 0x71, 0x03, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x19, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFC, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xFB, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x80, 0xDE, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x35, 0x8D, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xB1, 0xAD, 0x09, 0x00, 0x00, 0x00, 0x00, 0x80, 0xA2, 0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA1, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD9, 0x0C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x83, 0xC0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xB9, 0x0E, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xA0, 0xA9, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x99, 0x10, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x82, 0x89, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x79, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x64, 0x69, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x59, 0x14, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x46, 0x49, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x39, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x28, 0x29, 0x17, 0x00, 0x00, 0x00, 0x00, 0x80, 0x45, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x0A, 0x09, 0x19, 0x00, 0x00, 0x00, 0x00, 0x80, 0x27, 0x02, 0x1A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x26, 0xF2, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x80, 0x09, 0xE2, 0x1B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x08, 0xD2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x80, 0xEB, 0xC1, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xEA, 0xB1, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x80, 0xCD, 0xA1, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x1D, 0x76, 0x20, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAF, 0x81, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xFF, 0x55, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x6A, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE1, 0x35, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x4A, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC3, 0x15, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x2A, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xDF, 0xFE, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x0A, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC1, 0xDE, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xEA, 0x2A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA3, 0xBE, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0xD3, 0x2C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x85, 0x9E, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x80, 0x52, 0xB3, 0x2E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x67, 0x7E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x34, 0x93, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x84, 0x67, 0x31, 0x00, 0x00, 0x00, 0x00, 0x80, 0x16, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x66, 0x47, 0x33, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x48, 0x27, 0x35, 0x00, 0x00, 0x00, 0x00, 0x80, 0xDA, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x2A, 0x07, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x0C, 0xE7, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xEE, 0xC6, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x0A, 0xB0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xEC, 0x8F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xCE, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9B, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xB0, 0x4F, 0x42, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7D, 0x64, 0x43, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x92, 0x2F, 0x44, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5F, 0x44, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC5, 0xF3, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2D, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xA7, 0xD3, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0D, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x89, 0xB3, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xED, 0x4A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA5, 0x9C, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5C, 0xD6, 0x4C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x87, 0x7C, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3E, 0xB6, 0x4E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x69, 0x5C, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x4B, 0x3C, 0x51, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x76, 0x52, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x2D, 0x1C, 0x53, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE4, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x0F, 0xFC, 0x54, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC6, 0x35, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x2C, 0xE5, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x1E, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x0E, 0xC5, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFE, 0x59, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xF0, 0xA4, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xDE, 0x5B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD2, 0x84, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xBE, 0x5D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xB4, 0x64, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x9E, 0x5F, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xD0, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00, 0x80, 0x87, 0x87, 0x61, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xB2, 0x2D, 0x62, 0x00, 0x00, 0x00, 0x00, 0x80, 0x69, 0x67, 0x63, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x94, 0x0D, 0x64, 0x00, 0x00, 0x00, 0x00, 0x80, 0x4B, 0x47, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x76, 0xED, 0x65, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2D, 0x27, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x58, 0xCD, 0x67, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x07, 0x69, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x3A, 0xAD, 0x69, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF1, 0xE6, 0x6A, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x57, 0x96, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x6C, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x39, 0x76, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xAF, 0x6E, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x1B, 0x56, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xFD, 0x35, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x6F, 0x72, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xDF, 0x15, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x4F, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xFB, 0xFE, 0x74, 0x00, 0x00, 0x00, 0x00, 0x80, 0xB2, 0x38, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xDD, 0xDE, 0x76, 0x00, 0x00, 0x00, 0x00, 0x80, 0x94, 0x18, 0x78, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xBF, 0xBE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x80, 0x76, 0xF8, 0x79, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA1, 0x9E, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x80, 0x58, 0xD8, 0x7B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x83, 0x7E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3A, 0xB8, 0x7D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x65, 0x5E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1C, 0x98, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0x94, 0x9D, 0xFF, 0xFF, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAB, 0xFF, 0xFF,
+		0x01, 0x4D, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xFF, 0xFF, 0x00, 0x4D, 0x53, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xFF, 0xFF, 0x00, 0x4D, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xAB, 0xFF, 0xFF, 0x01, 0x4D, 0x57, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAB, 0xFF, 0xFF,
+		0x01, 0x4D, 0x50, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x04, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x4D, 0x53, 0x54, 0x37, 0x4D, 0x44, 0x54, 0x2C, 0x4D, 0x33,
+		0x2E, 0x32, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0xBA, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00, 0xC0, 0x1A, 0x04, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x48, 0xA6, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x15, 0xBB, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x2A, 0x86, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xF7, 0x9A, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x1A, 0x89, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xF4, 0x23, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x26, 0x61, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x74, 0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xAD, 0x80, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xC3, 0xFE, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x90, 0xC0, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xA5, 0xDE, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xAC, 0xA9, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x87, 0xBE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x8E, 0x89, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x69, 0x9E, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x70, 0x69, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x4B, 0x7E, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x52, 0x49, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x2D, 0x5E, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x34, 0x29, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4A, 0x47, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x51, 0x12, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0x27, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x33, 0xF2, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x0E, 0x07, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x15, 0xD2, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xF0, 0xE6, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0xF7, 0xB1, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xD2, 0xC6, 0xED, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0xD9, 0x91, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xEE, 0xAF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0xBB, 0x71, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xD0, 0x8F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xC1, 0x7F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xB2, 0x6F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xA3, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x94, 0x4F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x85, 0x3F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x76, 0x2F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0xA2, 0x28, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x58, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x84, 0x08, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x83, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x66, 0xE8, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x65, 0xD8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x48, 0xC8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x47, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x2A, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x29, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x0C, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0B, 0x78, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x28, 0x71, 0x03, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x27, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x0A, 0x51, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x41, 0x06, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xEC, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x43, 0x8D, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xCE, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x20, 0xBF, 0xAD, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xB0, 0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAF, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xCD, 0xD9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x91, 0xC0, 0x0D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAF, 0xB9, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x20, 0xAE, 0xA9, 0x0F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x91, 0x99, 0x10, 0x00, 0x00, 0x00, 0x00, 0x20, 0x90, 0x89, 0x11, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x73, 0x79, 0x12, 0x00, 0x00, 0x00, 0x00, 0x20, 0x72, 0x69, 0x13, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x55, 0x59, 0x14, 0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x49, 0x15, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x37, 0x39, 0x16, 0x00, 0x00, 0x00, 0x00, 0x20, 0x36, 0x29, 0x17, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x53, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x09, 0x19, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x35, 0x02, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x34, 0xF2, 0x1A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x17, 0xE2, 0x1B, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x16, 0xD2, 0x1C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF9, 0xC1, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xF8, 0xB1, 0x1E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xDB, 0xA1, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2B, 0x76, 0x20, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xBD, 0x81, 0x21, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0D, 0x56, 0x22, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xDA, 0x6A, 0x23, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEF, 0x35, 0x24, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xBC, 0x4A, 0x25, 0x00, 0x00, 0x00, 0x00, 0x20, 0xD1, 0x15, 0x26, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x9E, 0x2A, 0x27, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xED, 0xFE, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x80, 0x0A, 0x29, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xCF, 0xDE, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x62, 0xEA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xB1, 0xBE, 0x2B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x7E, 0xD3, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x93, 0x9E, 0x2D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x60, 0xB3, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x75, 0x7E, 0x2F, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x42, 0x93, 0x30, 0x00, 0x00, 0x00, 0x00, 0x20, 0x92, 0x67, 0x31, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x24, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x20, 0x74, 0x47, 0x33, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x06, 0x53, 0x34, 0x00, 0x00, 0x00, 0x00, 0x20, 0x56, 0x27, 0x35, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xE8, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0x07, 0x37, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x05, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1A, 0xE7, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE7, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xC6, 0x3A, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC9, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x18, 0xB0, 0x3C, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAB, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFA, 0x8F, 0x3E, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x8D, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xDC, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA9, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xBE, 0x4F, 0x42, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x8B, 0x64, 0x43, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xA0, 0x2F, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x6D, 0x44, 0x45, 0x00, 0x00, 0x00, 0x00, 0x20, 0xD3, 0xF3, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x8A, 0x2D, 0x47, 0x00, 0x00, 0x00, 0x00, 0x20, 0xB5, 0xD3, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x6C, 0x0D, 0x49, 0x00, 0x00, 0x00, 0x00, 0x20, 0x97, 0xB3, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x4E, 0xED, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xB3, 0x9C, 0x4B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x6A, 0xD6, 0x4C, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x95, 0x7C, 0x4D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x4C, 0xB6, 0x4E, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x77, 0x5C, 0x4F, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x2E, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x59, 0x3C, 0x51, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x10, 0x76, 0x52, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x3B, 0x1C, 0x53, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF2, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1D, 0xFC, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xD4, 0x35, 0x56, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3A, 0xE5, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xF1, 0x1E, 0x58, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0xC5, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD3, 0xFE, 0x59, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xA4, 0x5A, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xB5, 0xDE, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0x84, 0x5C, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x97, 0xBE, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC2, 0x64, 0x5E, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x79, 0x9E, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xDE, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x95, 0x87, 0x61, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xC0, 0x2D, 0x62, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x77, 0x67, 0x63, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xA2, 0x0D, 0x64, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x59, 0x47, 0x65, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x84, 0xED, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x3B, 0x27, 0x67, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x66, 0xCD, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x1D, 0x07, 0x69, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x48, 0xAD, 0x69, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xFF, 0xE6, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x20, 0x65, 0x96, 0x6B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x1C, 0xD0, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x47, 0x76, 0x6D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xFE, 0xAF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x20, 0x29, 0x56, 0x6F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE0, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0B, 0x36, 0x71, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC2, 0x6F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x20, 0xED, 0x15, 0x73, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xA4, 0x4F, 0x74, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x09, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC0, 0x38, 0x76, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xEB, 0xDE, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA2, 0x18, 0x78, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xCD, 0xBE, 0x78, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x84, 0xF8, 0x79, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAF, 0x9E, 0x7A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x66, 0xD8, 0x7B, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x91, 0x7E, 0x7C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x48, 0xB8, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x73, 0x5E, 0x7E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x2A, 0x98, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x26, 0x91, 0xFF, 0xFF, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xFF, 0xFF, 0x01, 0x50, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x8F, 0xFF, 0xFF, 0x00, 0x50, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xFF, 0xFF,
+		0x01, 0x50, 0x57, 0x54, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xFF, 0xFF, 0x01, 0x50, 0x50, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x80, 0x8F, 0xFF, 0xFF, 0x00, 0x50, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x05, 0x01, 0x02, 0x01, 0x02, 0x03, 0x04, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x50, 0x53, 0x54, 0x38, 0x50, 0x44,
+		0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x32, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x31, 0x2E, 0x31, 0x2E, 0x30,
+		0xEC, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00, 0x90, 0xF0, 0x03, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x1E, 0xA6, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xEB, 0xBA, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x00, 0x86, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xCD, 0x9A, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xE2, 0x65, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE9, 0x83, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xAE, 0x6A, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xA7, 0x35, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xCA, 0x53, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x89, 0x15, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xAC, 0x33, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xA5, 0xFE, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x8E, 0x13, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x87, 0xDE, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x70, 0xF3, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x69, 0xBE, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x52, 0xD3, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x4B, 0x9E, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x34, 0xB3, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2D, 0x7E, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x51, 0x9C, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x4A, 0x67, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x33, 0x7C, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x2C, 0x47, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x15, 0x5C, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x0E, 0x27, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xF7, 0x3B, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xF0, 0x06, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xD9, 0x1B, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xD2, 0xE6, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xF5, 0x04, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xB4, 0xC6, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xD7, 0xE4, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xD0, 0xAF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xB9, 0xC4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xB2, 0x8F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x9B, 0xA4, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x94, 0x6F, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x7D, 0x84, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x76, 0x4F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x5F, 0x64, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x58, 0x2F, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x7C, 0x4D, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3A, 0x0F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x5E, 0x2D, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x57, 0xF8, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x40, 0x0D, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x39, 0xD8, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xF0, 0x88, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xF4, 0x23, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xFB, 0x60, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE4, 0x75, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xDD, 0x40, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC6, 0x55, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xBF, 0x20, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xA8, 0x35, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xA1, 0x00, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8A, 0x15, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x83, 0xE0, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xA7, 0xFE, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x65, 0xC0, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x89, 0xDE, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x82, 0xA9, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x6B, 0xBE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x64, 0x89, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x4D, 0x9E, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x46, 0x69, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x2F, 0x7E, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x28, 0x49, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x11, 0x5E, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x2E, 0x57, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2D, 0x47, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x10, 0x37, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x27, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xF2, 0x16, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0x06, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xD4, 0xF6, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xD3, 0xE6, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xB6, 0xD6, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xB5, 0xC6, 0xED, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0xD3, 0xBF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xD2, 0xAF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0xB5, 0x9F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xB4, 0x8F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x97, 0x7F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x96, 0x6F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x79, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x78, 0x4F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x5B, 0x3F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x5A, 0x2F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x77, 0x28, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x3C, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x59, 0x08, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x58, 0xF8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x3B, 0xE8, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3A, 0xD8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x1D, 0xC8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1C, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xFF, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xE1, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE0, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xFE, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFD, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xE0, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x70, 0xDF, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xC2, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x70, 0x19, 0x8D, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xA4, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x94, 0xAD, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x86, 0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x70, 0x85, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xA2, 0xD9, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x67, 0xC0, 0x0D, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x84, 0xB9, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x83, 0xA9, 0x0F, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x66, 0x99, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x65, 0x89, 0x11, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x48, 0x79, 0x12, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x47, 0x69, 0x13, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x2A, 0x59, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x29, 0x49, 0x15, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x0C, 0x39, 0x16, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0x29, 0x17, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x29, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xED, 0x08, 0x19, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x0B, 0x02, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0A, 0xF2, 0x1A, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xED, 0xE1, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x70, 0xEC, 0xD1, 0x1C, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xCF, 0xC1, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x70, 0xCE, 0xB1, 0x1E, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xB1, 0xA1, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x76, 0x20, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x93, 0x81, 0x21, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE2, 0x55, 0x22, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xAF, 0x6A, 0x23, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC4, 0x35, 0x24, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x91, 0x4A, 0x25, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xA6, 0x15, 0x26, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x73, 0x2A, 0x27, 0x00, 0x00, 0x00, 0x00, 0x70, 0xC3, 0xFE, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x55, 0x0A, 0x29, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA5, 0xDE, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x37, 0xEA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x70, 0x87, 0xBE, 0x2B, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x54, 0xD3, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x69, 0x9E, 0x2D, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x36, 0xB3, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x4B, 0x7E, 0x2F, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x18, 0x93, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x67, 0x67, 0x31, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xFA, 0x72, 0x32, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x49, 0x47, 0x33, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xDC, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2B, 0x27, 0x35, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xBE, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0D, 0x07, 0x37, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xDA, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xEF, 0xE6, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xBC, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xD1, 0xC6, 0x3A, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x9E, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x70, 0xEE, 0xAF, 0x3C, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x80, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x70, 0xD0, 0x8F, 0x3E, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x62, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xB2, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x7F, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00, 0x70, 0x94, 0x4F, 0x42, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x61, 0x64, 0x43, 0x00, 0x00, 0x00, 0x00, 0x70, 0x76, 0x2F, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x43, 0x44, 0x45, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xA8, 0xF3, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x5F, 0x2D, 0x47, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x8A, 0xD3, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x41, 0x0D, 0x49, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6C, 0xB3, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x23, 0xED, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x70, 0x89, 0x9C, 0x4B, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x40, 0xD6, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6B, 0x7C, 0x4D, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x22, 0xB6, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x70, 0x4D, 0x5C, 0x4F, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x04, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2F, 0x3C, 0x51, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xE6, 0x75, 0x52, 0x00, 0x00, 0x00, 0x00, 0x70, 0x11, 0x1C, 0x53, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xC8, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF3, 0xFB, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xAA, 0x35, 0x56, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xE5, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xC6, 0x1E, 0x58, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF1, 0xC4, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xA8, 0xFE, 0x59, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xD3, 0xA4, 0x5A, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x8A, 0xDE, 0x5B, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB5, 0x84, 0x5C, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x6C, 0xBE, 0x5D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x97, 0x64, 0x5E, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x4E, 0x9E, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xB4, 0x4D, 0x60, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x6B, 0x87, 0x61, 0x00, 0x00, 0x00, 0x00, 0x70, 0x96, 0x2D, 0x62, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x4D, 0x67, 0x63, 0x00, 0x00, 0x00, 0x00, 0x70, 0x78, 0x0D, 0x64, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x2F, 0x47, 0x65, 0x00, 0x00, 0x00, 0x00, 0x70, 0x5A, 0xED, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x11, 0x27, 0x67, 0x00, 0x00, 0x00, 0x00, 0x70, 0x3C, 0xCD, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xF3, 0x06, 0x69, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1E, 0xAD, 0x69, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0xD5, 0xE6, 0x6A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3A, 0x96, 0x6B, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xF1, 0xCF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1C, 0x76, 0x6D, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xD3, 0xAF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFE, 0x55, 0x6F, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0xB5, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE0, 0x35, 0x71, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x97, 0x6F, 0x72, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC2, 0x15, 0x73, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x79, 0x4F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x70, 0xDF, 0xFE, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x96, 0x38, 0x76, 0x00, 0x00, 0x00, 0x00, 0x70, 0xC1, 0xDE, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x78, 0x18, 0x78, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA3, 0xBE, 0x78, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x5A, 0xF8, 0x79, 0x00, 0x00, 0x00, 0x00, 0x70, 0x85, 0x9E, 0x7A, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x3C, 0xD8, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x70, 0x67, 0x7E, 0x7C, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x1E, 0xB8, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x70, 0x49, 0x5E, 0x7E, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x00, 0x98, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xBA, 0xFF, 0xFF, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0xC0, 0xC7, 0xFF, 0xFF, 0x01, 0x45, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0xB0, 0xB9, 0xFF, 0xFF, 0x00, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xB9, 0xFF, 0xFF,
+		0x00, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC7, 0xFF, 0xFF, 0x01, 0x45, 0x57, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0xC0, 0xC7, 0xFF, 0xFF, 0x01, 0x45, 0x50, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x04, 0x05, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x45, 0x53, 0x54, 0x35,
+		0x45, 0x44, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x32, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x31, 0x2E, 0x31,
+		0x2E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00,
+		0xB4, 0x72, 0xAA, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x49, 0x0F, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x40, 0xFD, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x34, 0xF1, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x74, 0xDE, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0xAE, 0x38, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x30, 0xFA, 0xEB, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0x19, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x59, 0xB9, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x15, 0xFB, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xDE, 0x9B, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x9A, 0xDD, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x33, 0x54, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x09, 0x5A, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x5E, 0x05, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x64, 0xC0, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x1E, 0x0E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x2C, 0x51, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xC5, 0xC7, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xD2, 0x0A, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xF8, 0xA8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x06, 0xEC, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x7D, 0x8B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x8E, 0xC9, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xD7, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x35, 0xA0, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xCF, 0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x69, 0x81, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xC8, 0x0B, 0x22, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x10, 0x58, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x70, 0xE2, 0x23, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xF2, 0x37, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xC7, 0xD4, 0x25, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0F, 0x21, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xE3, 0xBD, 0x27, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF1, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x8B, 0x94, 0x29, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x0D, 0xEA, 0x2A, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x32, 0x6B, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB5, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xC4, 0x66, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x30, 0x97, 0xA0, 0x2E, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xA6, 0x46, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x79, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x4D, 0x1D, 0x31, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x20, 0x57, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x6A, 0x06, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x54, 0x38, 0x34, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xC1, 0xF8, 0x34, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1F, 0x20, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x68, 0xCF, 0x36, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xC6, 0xF6, 0x37, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x85, 0xB8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE3, 0xDF, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x2C, 0x8F, 0x3A, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xC8, 0x3B, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x0E, 0x6F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x30, 0x91, 0xC4, 0x3D, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xF0, 0x4E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x91, 0x3F, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xD2, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF8, 0x86, 0x41, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xEF, 0x17, 0x42, 0x00, 0x00, 0x00, 0x00, 0x30, 0xC2, 0x51, 0x43, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xD1, 0xF7, 0x43, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x53, 0x4D, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xED, 0xE0, 0x45, 0x00, 0x00, 0x00, 0x00, 0x30, 0x86, 0x11, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x95, 0xB7, 0x47, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xA2, 0xFA, 0x48, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x77, 0x97, 0x49, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x84, 0xDA, 0x4A, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x93, 0x80, 0x4B, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x66, 0xBA, 0x4C, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x75, 0x60, 0x4D, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x48, 0x9A, 0x4E, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x92, 0x49, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x30, 0x65, 0x83, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x39, 0x20, 0x51, 0x00, 0x00, 0x00, 0x00, 0x30, 0x47, 0x63, 0x52, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x1B, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x30, 0x29, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x38, 0xE9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0B, 0x23, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x1A, 0xC9, 0x56, 0x00, 0x00, 0x00, 0x00, 0x30, 0xED, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xFC, 0xA8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x30, 0xCF, 0xE2, 0x59, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xDE, 0x88, 0x5A, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x60, 0xDE, 0x5B, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xC0, 0x68, 0x5C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0x4C, 0xD4, 0xFF, 0xFF, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE3, 0xFF, 0xFF,
+		0x01, 0x2D, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD5, 0xFF, 0xFF, 0x00, 0x2D, 0x30, 0x33,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x02,
+		0x3C, 0x2D, 0x30, 0x33, 0x3E, 0x33, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00,
+		0xA8, 0x99, 0xF2, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0xD8, 0x33, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x00, 0x00,
+		0x00, 0x2B, 0x30, 0x34, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3C, 0x2B, 0x30, 0x34, 0x3E, 0x2D,
+		0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05, 0x00,
+		0x90, 0x63, 0x69, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x31, 0x4D, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x30, 0x93, 0xDB, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x71, 0x4B, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xDE, 0xA0, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xD7, 0x6B, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xB8, 0x58, 0x93, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xB0, 0x42, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xB8, 0x3A, 0x73, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x41, 0x3E, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xB8, 0x32, 0x2E, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x39, 0xF9, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xB8, 0x14, 0x0E, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x1B, 0xD9, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xB8, 0xF6, 0xED, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xFD, 0xB8, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xB8, 0xD8, 0xCD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x1A, 0xA2, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x38, 0xF5, 0xB6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xFC, 0x81, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0xC9, 0x96, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x69, 0x4F, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0xAB, 0x76, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x4B, 0x2F, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0xC7, 0x5F, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x2D, 0x0F, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0xA9, 0x3F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x49, 0xF8, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0x8B, 0x1F, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x2B, 0xD8, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0x6D, 0xFF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x0D, 0xB8, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0x4F, 0xDF, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xEF, 0x97, 0xED, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0x6C, 0xC8, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xD1, 0x77, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0x4E, 0xA8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xB3, 0x57, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0x30, 0x88, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xD0, 0x40, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0x12, 0x68, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xB2, 0x20, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0xF4, 0x47, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x7E, 0x25, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0x61, 0x15, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x60, 0x05, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x28, 0x43, 0xF5, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x42, 0xE5, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0x5F, 0xDE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x5E, 0xCE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0x41, 0xBE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x40, 0xAE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA8, 0x23, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x22, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xA8, 0x05, 0x7E, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x04, 0x6E, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0xA8, 0xE7, 0x5D, 0x03, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xE6, 0x4D, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x28, 0x04, 0x47, 0x05, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0x37, 0x06, 0x00, 0x00, 0x00, 0x00,
+		0x28, 0xE6, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3D, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x28, 0xC8, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC7, 0xF6, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0x28, 0xAA, 0xE6, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x38, 0xA9, 0xD6, 0x0B, 0x00, 0x00, 0x00, 0x00,
+		0x28, 0x8C, 0xC6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x39, 0x9B, 0x11, 0x00, 0x00, 0x00, 0x00,
+		0xA8, 0x6C, 0x6F, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x6B, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00, 0x00, 0x48, 0x4B, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x7E, 0x00, 0x00, 0x01, 0x48, 0x4B, 0x53, 0x54, 0x00, 0x00, 0x00, 0x88, 0x77, 0x00, 0x00,
+		0x01, 0x48, 0x4B, 0x57, 0x54, 0x00, 0x00, 0x00, 0x90, 0x7E, 0x00, 0x00, 0x00, 0x4A, 0x53, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00, 0x00, 0x48, 0x4B, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x7E, 0x00, 0x00, 0x01, 0x48, 0x4B, 0x53, 0x54, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00,
+		0x00, 0x48, 0x4B, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x07, 0x02, 0x05, 0x06,
+		0x05, 0x06, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x07, 0x02, 0x07, 0x02,
+		0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02,
+		0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02,
+		0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x48, 0x4B, 0x54,
+		0x2D, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+		0x28, 0x18, 0xBA, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0xEB, 0xE7, 0x43, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xBA, 0xBC, 0x9D, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x8C, 0xDB, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x18, 0x71, 0x05, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x32, 0x95, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x98, 0x12, 0x74, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x52, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0xD0, 0x52, 0x00, 0x00, 0x00, 0x48, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x46, 0x4B, 0x00, 0x00, 0x00, 0x4D, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x58, 0x4D, 0x00, 0x00,
+		0x00, 0x49, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x68, 0x5B, 0x00, 0x00, 0x01, 0x2B, 0x30, 0x36,
+		0x33, 0x30, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x03, 0x04, 0x03, 0x49, 0x53, 0x54, 0x2D, 0x35,
+		0x3A, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x05, 0x00,
+		0x78, 0xF0, 0xD7, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x16, 0xE6, 0x92, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x27, 0x43, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x8F, 0x65, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x9D, 0xEE, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xFA, 0xF8, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x2D, 0xCD, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8A, 0xD7, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0x0F, 0xAD, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE2, 0xE6, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xF1, 0x8C, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x29, 0x4F, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF8, 0xB7, 0x6B, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0x18, 0x13, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x78, 0x03, 0x62, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x4C, 0x11, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x78, 0x70, 0x2F, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0xF4, 0xE7, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x78, 0x52, 0x0F, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0xD6, 0xC7, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x78, 0x34, 0xEF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0xB8, 0xA7, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x78, 0x16, 0xCF, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x68, 0x9A, 0x87, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x78, 0x71, 0x35, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x60, 0xA3, 0x20, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x67, 0x6E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x90, 0x42, 0x83, 0x22, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x49, 0x4E, 0x23, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x88, 0x77, 0x00, 0x00, 0x00, 0x4B, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x7E, 0x00, 0x00, 0x00, 0x4A, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00,
+		0x01, 0x4B, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7E, 0x00, 0x00, 0x00, 0x4B, 0x53, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x98, 0x85, 0x00, 0x00, 0x01, 0x4B, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x8C, 0x00, 0x00, 0x01, 0x4B, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x03,
+		0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01,
+		0x05, 0x01, 0x05, 0x01, 0x04, 0x03, 0x04, 0x03, 0x04, 0x4B, 0x53, 0x54, 0x2D, 0x39, 0x00, 0x00,
+		0x1D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x29, 0x43, 0x36, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xA2, 0x97, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x04, 0x79, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x5E, 0x59, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xF9, 0x09, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0xBD, 0xD3, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8A, 0x05, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x40, 0x7C, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3E, 0x3B, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x7B, 0x8B, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAD, 0x42, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x22, 0x45, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0x4C, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0xBF, 0x3C, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x66, 0x06, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xF2, 0x1D, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x41, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x52, 0xBA, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9B, 0x69, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x84, 0x7E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7D, 0x49, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xA1, 0x67, 0x22, 0x00, 0x00, 0x00, 0x00, 0x90, 0x5F, 0x29, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x83, 0x47, 0x24, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7C, 0x12, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x65, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x10, 0x5E, 0xF2, 0x26, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x47, 0x07, 0x28, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0xD2, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0xD7, 0x71, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7E, 0x00, 0x00,
+		0x01, 0x43, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00, 0x00, 0x43, 0x53, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x43, 0x53, 0x54, 0x2D, 0x38, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00,
+		0xA3, 0x53, 0x36, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0x85, 0x83, 0x86, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x4E, 0x67, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xE4, 0x0A, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0xE5, 0xB3, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x5F, 0x91, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x6D, 0x48, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xEE, 0x91, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x61, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x5D, 0x61, 0x00, 0x00, 0x00, 0x53, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x62, 0x00, 0x00, 0x00, 0x2B, 0x30, 0x37, 0x00, 0x00, 0x00, 0x00, 0x20, 0x67, 0x00, 0x00,
+		0x01, 0x2B, 0x30, 0x37, 0x32, 0x30, 0x00, 0x00, 0x20, 0x67, 0x00, 0x00, 0x00, 0x2B, 0x30, 0x37,
+		0x32, 0x30, 0x00, 0x00, 0x78, 0x69, 0x00, 0x00, 0x00, 0x2B, 0x30, 0x37, 0x33, 0x30, 0x00, 0x00,
+		0x90, 0x7E, 0x00, 0x00, 0x00, 0x2B, 0x30, 0x39, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00,
+		0x00, 0x2B, 0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x05, 0x07,
+		0x07, 0x3C, 0x2B, 0x30, 0x38, 0x3E, 0x2D, 0x38, 0x29, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
+		0x18, 0xF0, 0xCE, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x49, 0x55, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x59, 0x54, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7B, 0x8B, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xAD, 0x42, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x22, 0x45, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xBF, 0x4C, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x3C, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x66, 0x06, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF2, 0x1D, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x99, 0xE7, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x26, 0xFF, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xCD, 0xC8, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x59, 0xE0, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x00, 0xAA, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x73, 0x72, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x64, 0xB5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x85, 0x7C, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x97, 0x96, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xB8, 0x5D, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xCB, 0x77, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xEC, 0x3E, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x20, 0x30, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x71, 0x21, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xA5, 0x12, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xA4, 0x02, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xD8, 0xF3, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xD8, 0xE3, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x0C, 0xD5, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xC5, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x3F, 0xB6, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xF7, 0xED, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xC4, 0x98, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xD9, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xF8, 0x79, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x56, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x8A, 0xED, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x89, 0xDD, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0xBD, 0xCE, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x80, 0xA1, 0xDB, 0x11, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0xDD, 0x54, 0x12, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x71, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00, 0x00, 0x43, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x7E, 0x00, 0x00, 0x00, 0x4A, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7E, 0x00, 0x00,
+		0x01, 0x43, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70, 0x00, 0x00, 0x00, 0x43, 0x53, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03,
+		0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03,
+		0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x43, 0x53, 0x54,
+		0x2D, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00,
+		0x70, 0xA4, 0xC2, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x02, 0x3E, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x59, 0xED, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xFA, 0xF8, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x3B, 0xCD, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x1D, 0xAD, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE2, 0xE6, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xFF, 0x8C, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x83, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00, 0x01, 0x4A, 0x44, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x7E, 0x00, 0x00, 0x00, 0x4A, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7E, 0x00, 0x00,
+		0x00, 0x4A, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x4A, 0x53, 0x54, 0x2D, 0x39, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0x00,
+		0x3C, 0x7F, 0x16, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC2, 0x4E, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x2F, 0xBC, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xB3, 0x54, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x65, 0xC7, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x56, 0xB7, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x47, 0xA7, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x73, 0xA0, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x29, 0x87, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x39, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x1C, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1B, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x38, 0xF6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFD, 0x2F, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x1A, 0xD6, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xDF, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xFC, 0xB5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xEF, 0x0A, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x19, 0x9F, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0xD8, 0x0C, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFB, 0x7E, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB8, 0x0E, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xDD, 0x5E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x98, 0x10, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xBF, 0x3E, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x78, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xA1, 0x1E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x58, 0x14, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x83, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x38, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x89, 0x0C, 0x17, 0x00, 0x00, 0x00, 0x00, 0x80, 0x64, 0x21, 0x18, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x81, 0xC7, 0x18, 0x00, 0x00, 0x00, 0x00, 0x80, 0x46, 0x01, 0x1A, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x63, 0xA7, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x80, 0x28, 0xE1, 0x1B, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x45, 0x87, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0A, 0xC1, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x9C, 0x79, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x97, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x7E, 0x59, 0x20, 0x00, 0x00, 0x00, 0x00, 0x80, 0xCE, 0x80, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x9B, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x69, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x7D, 0x22, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x49, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xEA, 0xEF, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x29, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xCC, 0xCF, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x09, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xAE, 0xAF, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xE9, 0x2A, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xCA, 0x98, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8F, 0xD2, 0x2C, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xAC, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x80, 0x71, 0xB2, 0x2E, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x8E, 0x58, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x53, 0x92, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x5A, 0x5D, 0x31, 0x00, 0x00, 0x00, 0x00, 0x80, 0x35, 0x72, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x3C, 0x3D, 0x33, 0x00, 0x00, 0x00, 0x00, 0x80, 0x17, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x1E, 0x1D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF9, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x00, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xE2, 0xDC, 0x38, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE9, 0xA7, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xC4, 0xBC, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xDA, 0x3B, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xE1, 0xA5, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xBA, 0x3D, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xC3, 0x85, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x9A, 0x3F, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xA5, 0x65, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0xBA, 0x83, 0x41, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x87, 0x45, 0x42, 0x00, 0x00, 0x00, 0x00, 0x80, 0x9C, 0x63, 0x43, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xA3, 0x2E, 0x44, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7E, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x4B, 0x05, 0x46, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x23, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xA2, 0xF7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xE7, 0x48, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x84, 0xD7, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xC7, 0x4A, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x66, 0xB7, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xA7, 0x4C, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x48, 0x97, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x87, 0x4E, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x2A, 0x77, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0x70, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x46, 0x60, 0x51, 0x00, 0x00, 0x00, 0x00, 0x80, 0x37, 0x50, 0x52, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x28, 0x40, 0x53, 0x00, 0x00, 0x00, 0x00, 0x80, 0x19, 0x30, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x0A, 0x20, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFB, 0x0F, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xEC, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x00, 0x80, 0xDD, 0xEF, 0x57, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xCE, 0xDF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x80, 0xBF, 0xCF, 0x59, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xB0, 0xBF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xB8, 0x5B, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xCD, 0xA8, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x98, 0x5D, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xAF, 0x88, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x78, 0x5F, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x91, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x58, 0x61, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x73, 0x48, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x38, 0x63, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x55, 0x28, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x18, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x71, 0x11, 0x66, 0x00, 0x00, 0x00, 0x00, 0x80, 0x62, 0x01, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x53, 0xF1, 0x67, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0xE1, 0x68, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x35, 0xD1, 0x69, 0x00, 0x00, 0x00, 0x00, 0x80, 0x26, 0xC1, 0x6A, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x17, 0xB1, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0xA1, 0x6C, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xF9, 0x90, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x80, 0xEA, 0x80, 0x6E, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xDB, 0x70, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6A, 0x70, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xF8, 0x59, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x49, 0x72, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xDA, 0x39, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x29, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xBC, 0x19, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x09, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x9E, 0xF9, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE9, 0x77, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x80, 0xD9, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xC9, 0x79, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x62, 0xB9, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8D, 0xB2, 0x7B, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x7E, 0xA2, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x80, 0x6F, 0x92, 0x7D, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x60, 0x82, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x51, 0x72, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0xC4, 0x8D, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x9A, 0x00, 0x00,
+		0x01, 0x41, 0x45, 0x44, 0x54, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00, 0x00, 0x41, 0x45, 0x53,
+		0x54, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00, 0x00, 0x41, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00,
+		0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x41, 0x45,
+		0x53, 0x54, 0x2D, 0x31, 0x30, 0x41, 0x45, 0x44, 0x54, 0x2C, 0x4D, 0x31, 0x30, 0x2E, 0x31, 0x2E,
+		0x30, 0x2C, 0x4D, 0x34, 0x2E, 0x31, 0x2E, 0x30, 0x2F, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x8F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1A, 0x00, 0xF8, 0x61, 0xA2, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x60, 0x17, 0x0C, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xDA, 0xD5, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xAE, 0xD9, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xB5, 0xA4, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x90, 0xB9, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x97, 0x84, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x71, 0x09, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4B, 0xE7, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x17, 0xA9, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x43, 0xA2, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x34, 0x92, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x25, 0x82, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x16, 0x72, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x96, 0xB6, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0xBE, 0x58, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x4F, 0xA1, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x1B, 0x63, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x23, 0x4B, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xD1, 0x39, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xE7, 0x67, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x73, 0xA8, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xB4, 0x29, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x1A, 0x2C, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x96, 0x09, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xC1, 0x02, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x78, 0xE9, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x44, 0x4D, 0x13, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFA, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xEB, 0x23, 0x15, 0x00, 0x00, 0x00, 0x00, 0x90, 0xDC, 0x13, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xCD, 0x03, 0x17, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBE, 0xF3, 0x17, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xAF, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x90, 0xA0, 0xD3, 0x19, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x91, 0xC3, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x10, 0xBD, 0xBC, 0x1B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAE, 0xAC, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x9F, 0x9C, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x90, 0x8C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x81, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x72, 0x6C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x5C, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x54, 0x4C, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x45, 0x3C, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x36, 0x2C, 0x24, 0x00, 0x00, 0x00, 0x00, 0x10, 0x27, 0x1C, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x18, 0x0C, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90, 0x43, 0x05, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x34, 0xF5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x90, 0x25, 0xE5, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x16, 0xD5, 0x29, 0x00, 0x00, 0x00, 0x00, 0x90, 0x07, 0xC5, 0x2A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF8, 0xB4, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x90, 0xE9, 0xA4, 0x2C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xDA, 0x94, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x90, 0xCB, 0x84, 0x2E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xBC, 0x74, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xAD, 0x64, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD9, 0x5D, 0x31, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB4, 0x72, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xBB, 0x3D, 0x33, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x9D, 0x1D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x10, 0x78, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x7F, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x00, 0x90, 0x94, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x61, 0xDD, 0x38, 0x00, 0x00, 0x00, 0x00, 0x90, 0x76, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x43, 0xBD, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x90, 0x58, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x5F, 0xA6, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x3A, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x41, 0x86, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x1C, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x23, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x39, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x05, 0x46, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1B, 0x64, 0x43, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xE7, 0x25, 0x44, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC9, 0x05, 0x46, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDF, 0x23, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE6, 0xEE, 0x47, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0x03, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC8, 0xCE, 0x49, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA3, 0xE3, 0x4A, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAA, 0xAE, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBF, 0xCC, 0x4C, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x8C, 0x8E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x90, 0xA1, 0xAC, 0x4E, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x6E, 0x6E, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x83, 0x8C, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x8A, 0x57, 0x51, 0x00, 0x00, 0x00, 0x00, 0x90, 0x65, 0x6C, 0x52, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x6C, 0x37, 0x53, 0x00, 0x00, 0x00, 0x00, 0x90, 0x47, 0x4C, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x4E, 0x17, 0x55, 0x00, 0x00, 0x00, 0x00, 0x90, 0x29, 0x2C, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x30, 0xF7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x10, 0x46, 0x15, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x12, 0xD7, 0x58, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0xF5, 0x59, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF4, 0xB6, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0A, 0xD5, 0x5B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x11, 0xA0, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEC, 0xB4, 0x5D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xF3, 0x7F, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x10, 0xCE, 0x94, 0x5F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD5, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x90, 0xEA, 0x7D, 0x61, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xB7, 0x3F, 0x62, 0x00, 0x00, 0x00, 0x00, 0x90, 0xCC, 0x5D, 0x63, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x99, 0x1F, 0x64, 0x00, 0x00, 0x00, 0x00, 0x90, 0xAE, 0x3D, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xB5, 0x08, 0x66, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x1D, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x97, 0xE8, 0x67, 0x00, 0x00, 0x00, 0x00, 0x90, 0x72, 0xFD, 0x68, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x79, 0xC8, 0x69, 0x00, 0x00, 0x00, 0x00, 0x90, 0x54, 0xDD, 0x6A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x5B, 0xA8, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x10, 0x71, 0xC6, 0x6C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x3D, 0x88, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0xA6, 0x6E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x1F, 0x68, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x35, 0x86, 0x70, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x3C, 0x51, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x17, 0x66, 0x72, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x1E, 0x31, 0x73, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0x45, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x00, 0x11, 0x75, 0x00, 0x00, 0x00, 0x00, 0x90, 0x15, 0x2F, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE2, 0xF0, 0x76, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF7, 0x0E, 0x78, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC4, 0xD0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x90, 0xD9, 0xEE, 0x79, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xA6, 0xB0, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBB, 0xCE, 0x7B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC2, 0x99, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xAE, 0x7D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA4, 0x79, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7F, 0x8E, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0x88, 0x0C, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00,
+		0x01, 0x43, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x00, 0x43, 0x45, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x01, 0x43, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00,
+		0x10, 0x0E, 0x00, 0x00, 0x00, 0x43, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00,
+		0x01, 0x43, 0x45, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x01, 0x43, 0x45, 0x4D,
+		0x54, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x01, 0x43, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00,
+		0x10, 0x0E, 0x00, 0x00, 0x00, 0x43, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x03,
+		0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x05, 0x01, 0x04, 0x03, 0x04, 0x03,
+		0x06, 0x01, 0x04, 0x03, 0x04, 0x03, 0x04, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+		0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+		0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+		0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+		0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+		0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+		0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+		0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x43, 0x45, 0x54, 0x2D, 0x31,
+		0x43, 0x45, 0x53, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x35, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x30, 0x2E,
+		0x35, 0x2E, 0x30, 0x2F, 0x33, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00,
+		0xCB, 0x09, 0x5D, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xAD, 0x26, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x05, 0xD6, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x30, 0xCF, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xC3, 0xA4, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x9D, 0x9C, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x1A, 0x97, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xBA, 0x85, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xFC, 0x76, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x9C, 0x65, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xC8, 0x7B, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xB8, 0x4E, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xFB, 0x3F, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x60, 0x25, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xC6, 0x27, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x2C, 0x2A, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xF8, 0xEB, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xD3, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x15, 0xD5, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xF0, 0xE9, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x6C, 0xC7, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xD2, 0xC9, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x4E, 0xA7, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x79, 0xA0, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x30, 0x87, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xD0, 0x92, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x4C, 0x70, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xB2, 0x72, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x2E, 0x50, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x5A, 0x49, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x10, 0x30, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x76, 0x32, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xF2, 0x0F, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x58, 0x12, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xD4, 0xEF, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0xE9, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xF1, 0xD8, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x57, 0xDB, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xD3, 0xB8, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xFE, 0xB1, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xB5, 0x98, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x1B, 0x9B, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x97, 0x78, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xFD, 0x7A, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x79, 0x58, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xA4, 0x51, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x5B, 0x38, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC1, 0x3A, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xD6, 0x58, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x09, 0xDA, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x26, 0x16, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x59, 0x97, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x1E, 0xD1, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x3B, 0x77, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0x00, 0xB1, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x58, 0x60, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xE2, 0x90, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x5E, 0x6E, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x16, 0x72, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x32, 0xFB, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xFE, 0x69, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x29, 0x63, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xE0, 0x49, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x21, 0x1E, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x90, 0xFD, 0x42, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xE0, 0xDF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xAC, 0x4E, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x03, 0xFE, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x8E, 0x2E, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x95, 0xF9, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x70, 0x0E, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xEC, 0xEB, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x17, 0xE5, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xCE, 0xCB, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0xF9, 0xC4, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEA, 0xB4, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x16, 0xAE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xCC, 0x94, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x48, 0x72, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x74, 0x6B, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x2A, 0x52, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x90, 0x54, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x0C, 0x32, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xAD, 0x3D, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x29, 0x1B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x54, 0x14, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x0B, 0xFB, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x71, 0xFD, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xED, 0xDA, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x53, 0xDD, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xCF, 0xBA, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xFA, 0xB3, 0xED, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xB1, 0x9A, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x67, 0x81, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x7D, 0x9F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x49, 0x61, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x5F, 0x7F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x66, 0x4A, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x41, 0x5F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0D, 0x21, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x23, 0x3F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEF, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0x05, 0x1F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xD1, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x20, 0xE7, 0xFE, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xB3, 0xC0, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x03, 0xE8, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xAB, 0x7B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xBB, 0xC7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xC6, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x58, 0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0xA8, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x3A, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x20, 0x8A, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x1C, 0xE9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x20, 0x6C, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xFE, 0xC8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x20, 0x4E, 0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0x1A, 0xB2, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0xD0, 0x0C, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xFC, 0x91, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x20, 0x12, 0xB0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xDE, 0x71, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2E, 0x99, 0x10, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xC0, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x10, 0x79, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0xA0, 0xA2, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xF2, 0x58, 0x14, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xEB, 0x23, 0x15, 0x00, 0x00, 0x00, 0x00, 0x90, 0xC6, 0x38, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xCD, 0x03, 0x17, 0x00, 0x00, 0x00, 0x00, 0x90, 0xA8, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xAF, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x90, 0x8A, 0xF8, 0x19, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x91, 0xC3, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA7, 0xE1, 0x1B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAE, 0xAC, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x89, 0xC1, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x90, 0x8C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x6B, 0xA1, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x72, 0x6C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4D, 0x81, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x54, 0x4C, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2F, 0x61, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x36, 0x2C, 0x24, 0x00, 0x00, 0x00, 0x00, 0x90, 0x4B, 0x4A, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x18, 0x0C, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90, 0x2D, 0x2A, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x34, 0xF5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0F, 0x0A, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x16, 0xD5, 0x29, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF1, 0xE9, 0x2A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF8, 0xB4, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x90, 0xD3, 0xC9, 0x2C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xDA, 0x94, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x90, 0xB5, 0xA9, 0x2E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xBC, 0x74, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x97, 0x89, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD9, 0x5D, 0x31, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB4, 0x72, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xBB, 0x3D, 0x33, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x9D, 0x1D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x10, 0x78, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x7F, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x00, 0x90, 0x94, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x61, 0xDD, 0x38, 0x00, 0x00, 0x00, 0x00, 0x90, 0x76, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x43, 0xBD, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x90, 0x58, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x5F, 0xA6, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x3A, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x41, 0x86, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x1C, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x23, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x39, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x05, 0x46, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1B, 0x64, 0x43, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xE7, 0x25, 0x44, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC9, 0x05, 0x46, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDF, 0x23, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE6, 0xEE, 0x47, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0x03, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC8, 0xCE, 0x49, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA3, 0xE3, 0x4A, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAA, 0xAE, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBF, 0xCC, 0x4C, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x8C, 0x8E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x90, 0xA1, 0xAC, 0x4E, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x6E, 0x6E, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x83, 0x8C, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x8A, 0x57, 0x51, 0x00, 0x00, 0x00, 0x00, 0x90, 0x65, 0x6C, 0x52, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x6C, 0x37, 0x53, 0x00, 0x00, 0x00, 0x00, 0x90, 0x47, 0x4C, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x4E, 0x17, 0x55, 0x00, 0x00, 0x00, 0x00, 0x90, 0x29, 0x2C, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x30, 0xF7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x10, 0x46, 0x15, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x12, 0xD7, 0x58, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0xF5, 0x59, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF4, 0xB6, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0A, 0xD5, 0x5B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x11, 0xA0, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEC, 0xB4, 0x5D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xF3, 0x7F, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x10, 0xCE, 0x94, 0x5F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD5, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x90, 0xEA, 0x7D, 0x61, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xB7, 0x3F, 0x62, 0x00, 0x00, 0x00, 0x00, 0x90, 0xCC, 0x5D, 0x63, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x99, 0x1F, 0x64, 0x00, 0x00, 0x00, 0x00, 0x90, 0xAE, 0x3D, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xB5, 0x08, 0x66, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x1D, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x97, 0xE8, 0x67, 0x00, 0x00, 0x00, 0x00, 0x90, 0x72, 0xFD, 0x68, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x79, 0xC8, 0x69, 0x00, 0x00, 0x00, 0x00, 0x90, 0x54, 0xDD, 0x6A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x5B, 0xA8, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x10, 0x71, 0xC6, 0x6C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x3D, 0x88, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0xA6, 0x6E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x1F, 0x68, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x35, 0x86, 0x70, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x3C, 0x51, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x17, 0x66, 0x72, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x1E, 0x31, 0x73, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0x45, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x00, 0x11, 0x75, 0x00, 0x00, 0x00, 0x00, 0x90, 0x15, 0x2F, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE2, 0xF0, 0x76, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF7, 0x0E, 0x78, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC4, 0xD0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x90, 0xD9, 0xEE, 0x79, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xA6, 0xB0, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBB, 0xCE, 0x7B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC2, 0x99, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xAE, 0x7D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA4, 0x79, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7F, 0x8E, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0xB5, 0xFF, 0xFF, 0xFF, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x00, 0x00,
+		0x01, 0x42, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x01, 0x42, 0x44, 0x53, 0x54, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x00, 0x00,
+		0x00, 0x42, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x01, 0x42, 0x53, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x05, 0x07, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+		0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+		0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+		0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+		0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+		0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+		0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+		0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
+		0x06, 0x07, 0x47, 0x4D, 0x54, 0x30, 0x42, 0x53, 0x54, 0x2C, 0x4D, 0x33, 0x2E, 0x35, 0x2E, 0x30,
+		0x2F, 0x31, 0x2C, 0x4D, 0x31, 0x30, 0x2E, 0x35, 0x2E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x4E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0xC7, 0xC0, 0xB6, 0x56, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xC7, 0x1E, 0x5F, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xF2, 0x3E, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF9, 0xEE, 0x2A, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0x69, 0x39, 0xF7, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF9, 0x57, 0x84, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x6C, 0xD8, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x80, 0x39, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xA6, 0x3C, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xC0, 0x6D, 0x10, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x32, 0x3D, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xB0, 0x68, 0x15, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x3D, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x50, 0x45, 0x1E, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x19, 0xA4, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xD0, 0xA7, 0x27, 0x15, 0x00, 0x00, 0x00, 0x00, 0x40, 0xDC, 0x18, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0x50, 0xDB, 0x08, 0x17, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0xFA, 0x17, 0x00, 0x00, 0x00, 0x00,
+		0xD0, 0x0E, 0xEA, 0x18, 0x00, 0x00, 0x00, 0x00, 0x40, 0x43, 0xDB, 0x19, 0x00, 0x00, 0x00, 0x00,
+		0xD0, 0x93, 0xCC, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xA0, 0xBC, 0x1B, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x91, 0xAC, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x82, 0x9C, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x73, 0x8C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x64, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x55, 0x6C, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x46, 0x5C, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x37, 0x4C, 0x22, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x28, 0x3C, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x19, 0x2C, 0x24, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0A, 0x1C, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0xFB, 0x0B, 0x26, 0x00, 0x00, 0x00, 0x00, 0x70, 0x27, 0x05, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x18, 0xF5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x80, 0x17, 0xE5, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xBF, 0x78, 0x29, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFA, 0xD4, 0x29, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0xEB, 0xC4, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x70, 0xDC, 0xB4, 0x2B, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0xCD, 0xA4, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x70, 0xBE, 0x94, 0x2D, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0xAF, 0x84, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x74, 0x2F, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x91, 0x64, 0x30, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBC, 0x5D, 0x31, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x97, 0x72, 0x32, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x9E, 0x3D, 0x33, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x79, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x1D, 0x35, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x5B, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x62, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x78, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x44, 0xDD, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x5A, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x26, 0xBD, 0x3A, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x3C, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x70, 0x43, 0xA6, 0x3C, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x1E, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x70, 0x25, 0x86, 0x3E, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x00, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x1C, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00, 0x70, 0xE9, 0x45, 0x42, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0xFE, 0x63, 0x43, 0x00, 0x00, 0x00, 0x00, 0x70, 0xCB, 0x25, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0xE0, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00, 0x70, 0xAD, 0x05, 0x46, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0xC2, 0x23, 0x47, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC9, 0xEE, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0xA4, 0x03, 0x49, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xAB, 0xCE, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0xF0, 0x86, 0xE3, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x8D, 0xAE, 0x4B, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0xA3, 0xCC, 0x4C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x8E, 0x4D, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x1D, 0x4C, 0x54, 0x00, 0x00, 0x00, 0x00, 0x39, 0x23, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x39, 0x23, 0x00, 0x00, 0x00, 0x4D, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x87, 0x31, 0x00, 0x00, 0x01, 0x4D, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x77, 0x23, 0x00, 0x00,
+		0x00, 0x4D, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x97, 0x3F, 0x00, 0x00, 0x01, 0x4D, 0x44, 0x53,
+		0x54, 0x00, 0x00, 0x00, 0x40, 0x38, 0x00, 0x00, 0x01, 0x4D, 0x53, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x2A, 0x00, 0x00, 0x00, 0x4D, 0x53, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x00, 0x00,
+		0x01, 0x4D, 0x53, 0x44, 0x00, 0x00, 0x00, 0x00, 0x50, 0x46, 0x00, 0x00, 0x01, 0x2B, 0x30, 0x35,
+		0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x45, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x2A, 0x00, 0x00, 0x00, 0x4D, 0x53, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x00, 0x00,
+		0x01, 0x4D, 0x53, 0x44, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x01, 0x45, 0x45, 0x53,
+		0x54, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x00, 0x45, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x38, 0x00, 0x00, 0x00, 0x4D, 0x53, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x00, 0x00,
+		0x01, 0x4D, 0x53, 0x44, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x00, 0x4D, 0x53, 0x4B,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x03, 0x04, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x07,
+		0x06, 0x09, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B,
+		0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0C, 0x0D, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A,
+		0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A,
+		0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A, 0x0B, 0x0A,
+		0x0E, 0x0A, 0x4D, 0x53, 0x4B, 0x2D, 0x33, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x1A, 0x00,
+		0xCF, 0x9B, 0xC9, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x50, 0x60, 0x91, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x78, 0x47, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x2C, 0xD7, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x91, 0xBC, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x48, 0xC0, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xFE, 0x89, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xA0, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xA5, 0x60, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0C, 0x80, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x12, 0x2E, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x4C, 0x7A, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x81, 0x35, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x23, 0x5E, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x35, 0x25, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x9B, 0x27, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x26, 0x58, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7D, 0x07, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x34, 0xEE, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x5F, 0xE7, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x50, 0xD7, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x41, 0xC7, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xA7, 0xC9, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x23, 0xA7, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x4F, 0xA0, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x05, 0x87, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x6B, 0x89, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x22, 0x70, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x88, 0x72, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x04, 0x50, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x2F, 0x49, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xE6, 0x2F, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x4C, 0x32, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xC8, 0x0F, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0xB9, 0xFF, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xAA, 0xEF, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x60, 0xD6, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC6, 0xD8, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xB7, 0xC8, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xA8, 0xB8, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x5F, 0x9F, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8A, 0x98, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0xF0, 0x9A, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6C, 0x78, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x5D, 0x68, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x4E, 0x58, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x70, 0x05, 0x3F, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x38, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xF0, 0x96, 0x3A, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xAC, 0x58, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xA0, 0x09, 0xDA, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x27, 0x6C, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x4B, 0xE7, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x17, 0xA9, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x43, 0xA2, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x34, 0x92, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xE0, 0xE1, 0x4F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF1, 0x89, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x10, 0x16, 0x72, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x40, 0x4E, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x39, 0xBB, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1B, 0xAB, 0x0C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x63, 0xA4, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1A, 0x8B, 0x0E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x45, 0x84, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x36, 0x74, 0x10, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x27, 0x64, 0x11, 0x00, 0x00, 0x00, 0x00, 0x90, 0x18, 0x54, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x44, 0x4D, 0x13, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFA, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xEB, 0x23, 0x15, 0x00, 0x00, 0x00, 0x00, 0x90, 0xDC, 0x13, 0x16, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xCD, 0x03, 0x17, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBE, 0xF3, 0x17, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xAF, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x90, 0xA0, 0xD3, 0x19, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x91, 0xC3, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x10, 0xBD, 0xBC, 0x1B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAE, 0xAC, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x9F, 0x9C, 0x1D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x90, 0x8C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x81, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x72, 0x6C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0x5C, 0x21, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x54, 0x4C, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x45, 0x3C, 0x23, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x36, 0x2C, 0x24, 0x00, 0x00, 0x00, 0x00, 0x10, 0x27, 0x1C, 0x25, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x18, 0x0C, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90, 0x43, 0x05, 0x27, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x34, 0xF5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x90, 0x25, 0xE5, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x16, 0xD5, 0x29, 0x00, 0x00, 0x00, 0x00, 0x90, 0x07, 0xC5, 0x2A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF8, 0xB4, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x90, 0xE9, 0xA4, 0x2C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xDA, 0x94, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x90, 0xCB, 0x84, 0x2E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xBC, 0x74, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xAD, 0x64, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD9, 0x5D, 0x31, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB4, 0x72, 0x32, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xBB, 0x3D, 0x33, 0x00, 0x00, 0x00, 0x00, 0x10, 0x96, 0x52, 0x34, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x9D, 0x1D, 0x35, 0x00, 0x00, 0x00, 0x00, 0x10, 0x78, 0x32, 0x36, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x7F, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x00, 0x90, 0x94, 0x1B, 0x38, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x61, 0xDD, 0x38, 0x00, 0x00, 0x00, 0x00, 0x90, 0x76, 0xFB, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x43, 0xBD, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x90, 0x58, 0xDB, 0x3B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x5F, 0xA6, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x3A, 0xBB, 0x3D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x41, 0x86, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x1C, 0x9B, 0x3F, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x23, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x39, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x05, 0x46, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1B, 0x64, 0x43, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xE7, 0x25, 0x44, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC9, 0x05, 0x46, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDF, 0x23, 0x47, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE6, 0xEE, 0x47, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0x03, 0x49, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC8, 0xCE, 0x49, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA3, 0xE3, 0x4A, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xAA, 0xAE, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBF, 0xCC, 0x4C, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x8C, 0x8E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x90, 0xA1, 0xAC, 0x4E, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x6E, 0x6E, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x90, 0x83, 0x8C, 0x50, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x8A, 0x57, 0x51, 0x00, 0x00, 0x00, 0x00, 0x90, 0x65, 0x6C, 0x52, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x6C, 0x37, 0x53, 0x00, 0x00, 0x00, 0x00, 0x90, 0x47, 0x4C, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x4E, 0x17, 0x55, 0x00, 0x00, 0x00, 0x00, 0x90, 0x29, 0x2C, 0x56, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x30, 0xF7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x10, 0x46, 0x15, 0x58, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x12, 0xD7, 0x58, 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0xF5, 0x59, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xF4, 0xB6, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0A, 0xD5, 0x5B, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x11, 0xA0, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xEC, 0xB4, 0x5D, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xF3, 0x7F, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x10, 0xCE, 0x94, 0x5F, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xD5, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x90, 0xEA, 0x7D, 0x61, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xB7, 0x3F, 0x62, 0x00, 0x00, 0x00, 0x00, 0x90, 0xCC, 0x5D, 0x63, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x99, 0x1F, 0x64, 0x00, 0x00, 0x00, 0x00, 0x90, 0xAE, 0x3D, 0x65, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xB5, 0x08, 0x66, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x1D, 0x67, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x97, 0xE8, 0x67, 0x00, 0x00, 0x00, 0x00, 0x90, 0x72, 0xFD, 0x68, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x79, 0xC8, 0x69, 0x00, 0x00, 0x00, 0x00, 0x90, 0x54, 0xDD, 0x6A, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x5B, 0xA8, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x10, 0x71, 0xC6, 0x6C, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x3D, 0x88, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0xA6, 0x6E, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x1F, 0x68, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x35, 0x86, 0x70, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x3C, 0x51, 0x71, 0x00, 0x00, 0x00, 0x00, 0x10, 0x17, 0x66, 0x72, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x1E, 0x31, 0x73, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF9, 0x45, 0x74, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x00, 0x11, 0x75, 0x00, 0x00, 0x00, 0x00, 0x90, 0x15, 0x2F, 0x76, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xE2, 0xF0, 0x76, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF7, 0x0E, 0x78, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xC4, 0xD0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x90, 0xD9, 0xEE, 0x79, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xA6, 0xB0, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x90, 0xBB, 0xCE, 0x7B, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xC2, 0x99, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x90, 0x9D, 0xAE, 0x7D, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xA4, 0x79, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7F, 0x8E, 0x7F, 0x00, 0x00, 0x00, 0x00,
+		0x31, 0x02, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00,
+		0x00, 0x50, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x01, 0x57, 0x45, 0x53,
+		0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x0E, 0x00, 0x00, 0x01, 0x57, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x57, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x00, 0x43, 0x45, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x01, 0x43, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00,
+		0x20, 0x1C, 0x00, 0x00, 0x01, 0x43, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00,
+		0x01, 0x57, 0x45, 0x4D, 0x54, 0x00, 0x00, 0x00, 0x10, 0x0E, 0x00, 0x00, 0x00, 0x43, 0x45, 0x54,
+		0x00, 0x00, 0x00, 0x00, 0x20, 0x1C, 0x00, 0x00, 0x01, 0x43, 0x45, 0x53, 0x54, 0x00, 0x00, 0x00,
+		0x10, 0x0E, 0x00, 0x00, 0x00, 0x43, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x02, 0x03,
+		0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+		0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+		0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x04, 0x08,
+		0x06, 0x07, 0x06, 0x07, 0x09, 0x04, 0x09, 0x0A, 0x08, 0x0A, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C, 0x0B, 0x0C,
+		0x0B, 0x0C, 0x0B, 0x0C, 0x43, 0x45, 0x54, 0x2D, 0x31, 0x43, 0x45, 0x53, 0x54, 0x2C, 0x4D, 0x33,
+		0x2E, 0x35, 0x2E, 0x30, 0x2C, 0x4D, 0x31, 0x30, 0x2E, 0x35, 0x2E, 0x30, 0x2F, 0x33, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x43,
+		0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x43, 0x30,
+	};
+}
@@ -1,15 +1,78 @@
 module;
 #include "MasterQian.Meta.h"
 #include <string>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <intrin.h>
+#include <algorithm>
+#include "MasterQian.Time.Zone.h"
 #define MasterQianModuleVersion 20240131ULL
 
 export module MasterQian.Time;
 export import MasterQian.freestanding;
 
+namespace MasterQian::api {
+	META_WINAPI(mqbool, QueryPerformanceCounter, mqi64*);
+	META_WINAPI(mqbool, QueryPerformanceFrequency, mqi64*);
+}
+
+#pragma comment(linker,"/alternatename:__imp_?QueryPerformanceCounter@api@MasterQian@@YAHPEA_J@Z::<!MasterQian.Time>=__imp_QueryPerformanceCounter")
+#pragma comment(linker,"/alternatename:__imp_?QueryPerformanceFrequency@api@MasterQian@@YAHPEA_J@Z::<!MasterQian.Time>=__imp_QueryPerformanceFrequency")
+
 namespace MasterQian {
 	namespace details {
 		constexpr mqui64 UnixDST{ 116444736000000000ULL };
 		constexpr mqui64 BASE10POW[]{ 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL };
+		constexpr mqi64 TicksPerSecond{ 10000000LL };
+		constexpr mqi64 TicksPerDay{ 86400LL * TicksPerSecond };
+
+		// ȡĳ
+		inline constexpr mqi64 FloorDiv(mqi64 a, mqi64 b) noexcept {
+			return a / b - (a % b < 0LL ? 1LL : 0LL);
+		}
+
+		// ڵ1970-01-01
+		inline constexpr mqi64 DaysFromCivil(mqi64 y, mqui32 m, mqui32 d) noexcept {
+			y -= m <= 2U ? 1LL : 0LL;
+			mqi64 era{ (y >= 0LL ? y : y - 399LL) / 400LL };
+			auto yoe{ static_cast<mqui32>(y - era * 400LL) }; // [0, 399]
+			auto doy{ (153U * (m > 2U ? m - 3U : m + 9U) + 2U) / 5U + d - 1U }; // [0, 365]
+			auto doe{ yoe * 365U + yoe / 4U - yoe / 100U + doy }; // [0, 146096]
+			return era * 146097LL + static_cast<mqi64>(doe) - 719468LL;
+		}
+
+		// 1970-01-01
+		inline constexpr void CivilFromDays(mqi64 z, mqi64& y, mqui32& m, mqui32& d) noexcept {
+			z += 719468LL;
+			mqi64 era{ (z >= 0LL ? z : z - 146096LL) / 146097LL };
+			auto doe{ static_cast<mqui32>(z - era * 146097LL) }; // [0, 146096]
+			auto yoe{ (doe - doe / 1460U + doe / 36524U - doe / 146096U) / 365U }; // [0, 399]
+			auto doy{ doe - (365U * yoe + yoe / 4U - yoe / 100U) }; // [0, 365]
+			auto mp{ (5U * doy + 2U) / 153U }; // [0, 11]
+			d = doy - (153U * mp + 2U) / 5U + 1U;
+			m = mp < 10U ? mp + 3U : mp - 9U;
+			y = static_cast<mqi64>(yoe) + era * 400LL + (m <= 2U ? 1LL : 0LL);
+		}
+
+		// 1970-01-01ڣ0Ϊ
+		inline constexpr mqui32 WeekdayFromDays(mqi64 z) noexcept {
+			return static_cast<mqui32>(z >= -4LL ? (z + 4LL) % 7LL : (z + 5LL) % 7LL + 6LL);
+		}
+
+		template<typename Char>
+		concept time_char = freestanding::same<Char, mqchara> || freestanding::same<Char, mqchar>;
+
+		// д붨ʮ㲹0
+		template<mqui32 N, time_char Char>
+		inline constexpr Char* TimeDigits(Char* p, mqui32 v) noexcept {
+			for (mqui32 i{ N }; i > 0U; --i) {
+				p[i - 1U] = static_cast<Char>('0' + v % 10U);
+				v /= 10U;
+			}
+			return p + N;
+		}
 	}
 
 	// ʱ
@@ -33,41 +96,96 @@ namespace MasterQian {
 			return year == t.year && month == t.month && day == t.day;
 		}
 
+		// ʽ󳤶ȣβ0
+		static constexpr mqui64 FormatSize{ 30ULL };
+		static constexpr mqui64 FormatDateSize{ 8ULL };
+		static constexpr mqui64 FormatTimeSize{ 6ULL };
+		static constexpr mqui64 FormatDateTimeSize{ 14ULL };
+
+		/// <summary>
+		/// ʽ÷2024-01-23 22:38:49.012.3400 2дβ0
+		/// </summary>
+		/// <param name="p">FormatSizeַ</param>
+		/// <returns>дĩβ</returns>
+		template<details::time_char Char>
+		constexpr Char* formatTo(Char* p) const noexcept {
+			p = details::TimeDigits<4U>(p, year % 10000U);
+			*p++ = static_cast<Char>('-');
+			p = details::TimeDigits<2U>(p, month);
+			*p++ = static_cast<Char>('-');
+			p = details::TimeDigits<2U>(p, day);
+			*p++ = static_cast<Char>(' ');
+			p = details::TimeDigits<2U>(p, hour);
+			*p++ = static_cast<Char>(':');
+			p = details::TimeDigits<2U>(p, minute);
+			*p++ = static_cast<Char>(':');
+			p = details::TimeDigits<2U>(p, second);
+			*p++ = static_cast<Char>('.');
+			p = details::TimeDigits<3U>(p, millisecond % 1000U);
+			*p++ = static_cast<Char>('.');
+			p = details::TimeDigits<4U>(p, microsecond % 10000U);
+			*p++ = static_cast<Char>(' ');
+			return details::TimeDigits<1U>(p, week % 10U);
+		}
+
 		/// <summary>
-		/// ʽ2024-01-23 22:38:49.0123 2
+		/// ʽ÷20240123
+		/// </summary>
+		template<details::time_char Char>
+		constexpr Char* formatDateTo(Char* p) const noexcept {
+			p = details::TimeDigits<4U>(p, year % 10000U);
+			p = details::TimeDigits<2U>(p, month);
+			return details::TimeDigits<2U>(p, day);
+		}
+
+		/// <summary>
+		/// ʽ÷223849
+		/// </summary>
+		template<details::time_char Char>
+		constexpr Char* formatTimeTo(Char* p) const noexcept {
+			p = details::TimeDigits<2U>(p, hour);
+			p = details::TimeDigits<2U>(p, minute);
+			return details::TimeDigits<2U>(p, second);
+		}
+
+		/// <summary>
+		/// ʽ÷20240123223849
+		/// </summary>
+		template<details::time_char Char>
+		constexpr Char* formatDateTimeTo(Char* p) const noexcept {
+			return formatTimeTo(formatDateTo(p));
+		}
+
+		/// <summary>
+		/// ʽ2024-01-23 22:38:49.012.3400 2
 		/// </summary>
 		[[nodiscard]] std::wstring format() const noexcept {
-			mqchar str[32ULL];
-			api::wsprintfW(str, L"%04hu-%02u-%02u %02u:%02u:%02u.%03hu.%04hu %u",
-				year, month, day, hour, minute, second, millisecond, microsecond, week);
-			return str;
+			mqchar str[FormatSize];
+			return { str, formatTo(str) };
 		}
 
 		/// <summary>
 		/// ʽ20240123
 		/// </summary>
 		[[nodiscard]] std::wstring formatDate() const noexcept {
-			mqchar str[16ULL];
-			api::wsprintfW(str, L"%04hu%02u%02u", year, month, day);
-			return str;
+			mqchar str[FormatDateSize];
+			return { str, formatDateTo(str) };
 		}
 
 		/// <summary>
 		/// ʽ223849
 		/// </summary>
 		[[nodiscard]] std::wstring formatTime() const noexcept {
-			mqchar str[8ULL];
-			api::wsprintfW(str, L"%02u%02u%02u", hour, minute, second);
-			return str;
+			mqchar str[FormatTimeSize];
+			return { str, formatTimeTo(str) };
 		}
 
 		/// <summary>
 		/// ʽ20240123223849
 		/// </summary>
 		[[nodiscard]] std::wstring formatDateTime() const noexcept {
-			mqchar str[32ULL];
-			api::wsprintfW(str, L"%04hu%02u%02u%02u%02u%02u", year, month, day, hour, minute, second);
-			return str;
+			mqchar str[FormatDateTimeSize];
+			return { str, formatDateTimeTo(str) };
 		}
 	};
 
@@ -111,23 +229,14 @@ namespace MasterQian {
 		}
 
 		/// <summary>
-		/// ʱ乹
+		/// ʱ乹죬ֱӼ㣬Χֶ˳
 		/// </summary>
 		/// <param name="t">ʱ</param>
 		/// <param name="zone">ʱĬΪ</param>
-		Timestamp(Time const& t, Zone zone = Zone::CN_BEIJING) noexcept {
-			mqsystemtime st{
-				.year = t.year,
-				.month = t.month,
-				.week = t.week,
-				.day = t.day,
-				.hour = t.hour,
-				.minute = t.minute,
-				.second = t.second,
-				.millisecond = t.millisecond
-			};
-			api::SystemTimeToFileTime(&st, &value);
-			value -= details::UnixDST + zone - t.microsecond;
+		constexpr Timestamp(Time const& t, Zone zone = Zone::CN_BEIJING) noexcept {
+			auto days{ details::DaysFromCivil(t.year, t.month, t.day) };
+			auto seconds{ days * 86400LL + t.hour * 3600LL + t.minute * 60LL + t.second };
+			value = static_cast<mqui64>(seconds * details::TicksPerSecond + t.millisecond * 10000LL + t.microsecond) - zone;
 		}
 
 		/// <summary>
@@ -147,13 +256,18 @@ namespace MasterQian {
 		/// </summary>
 		/// <param name="zone">ʱ</param>
 		/// <returns>ʱӦʱʱ</returns>
-		Time local(Zone zone = Zone::CN_BEIJING) const noexcept {
-			mqui64 zone_value = value + details::UnixDST + zone;
-			mqsystemtime st{ };
-			api::FileTimeToSystemTime(&zone_value, &st);
-			return Time{ st.year, static_cast<mqui8>(st.month), static_cast<mqui8>(st.day),
-				static_cast<mqui8>(st.hour), static_cast<mqui8>(st.minute), static_cast<mqui8>(st.second),
-				st.millisecond, static_cast<mqui16>(zone_value % 10000ULL), static_cast<mqui8>(st.week)
+		[[nodiscard]] constexpr Time local(Zone zone = Zone::CN_BEIJING) const noexcept {
+			auto ticks{ static_cast<mqi64>(value + zone) };
+			auto days{ details::FloorDiv(ticks, details::TicksPerDay) };
+			auto rest{ ticks - days * details::TicksPerDay };
+			mqi64 year{ };
+			mqui32 month{ }, day{ };
+			details::CivilFromDays(days, year, month, day);
+			auto seconds{ rest / details::TicksPerSecond };
+			return Time{ static_cast<mqui16>(year), static_cast<mqui8>(month), static_cast<mqui8>(day),
+				static_cast<mqui8>(seconds / 3600LL), static_cast<mqui8>(seconds / 60LL % 60LL), static_cast<mqui8>(seconds % 60LL),
+				static_cast<mqui16>(rest / 10000LL % 1000LL), static_cast<mqui16>(rest % 10000LL),
+				static_cast<mqui8>(details::WeekdayFromDays(days))
 			};
 		}
 
@@ -193,10 +307,1605 @@ namespace MasterQian {
 	};
 }
 
+namespace MasterQian {
+	namespace details {
+		// ʱӵУ׼
+		struct ClockCalibration {
+			bool tsc; // ǷʹòɱTSC
+			mqui64 frequency; // ÿ
+			mqui64 toTimestamp; // 10032.32㱶
+			mqui64 toNanosecond; // 32.32㱶
+			mqui64 origin; // У׼ʱļ
+			mqui64 wall; // У׼ʱϵͳʱ
+		};
+
+		inline mqui64 QpcTicks() noexcept {
+			mqi64 value{ };
+			api::QueryPerformanceCounter(&value);
+			return static_cast<mqui64>(value);
+		}
+
+		inline mqui64 TscTicks() noexcept {
+			mqui32 aux;
+			return __rdtscp(&aux);
+		}
+
+		// ֧RDTSCPTSCƵԴ״̬仯
+		inline bool InvariantTsc() noexcept {
+			int regs[4]{ };
+			__cpuid(regs, static_cast<int>(0x80000000U));
+			if (static_cast<mqui32>(regs[0]) < 0x80000007U) return false;
+			__cpuid(regs, static_cast<int>(0x80000001U));
+			if ((regs[3] & (1 << 27)) == 0) return false;
+			__cpuid(regs, static_cast<int>(0x80000007U));
+			return (regs[3] & (1 << 8)) != 0;
+		}
+
+		inline mqui64 ClockScale(mqui64 unit, mqui64 frequency) noexcept {
+			return (unit << 32ULL) / frequency;
+		}
+
+		inline mqui64 ClockMul(mqui64 ticks, mqui64 scale) noexcept {
+			mqui64 high{ };
+			auto low{ _umul128(ticks, scale, &high) };
+			return (high << 32ULL) | (low >> 32ULL);
+		}
+
+		// ״ʹʱУ׼QPCΪ׼Լ10ڵTSC
+		inline ClockCalibration const& Clock() noexcept {
+			static ClockCalibration const calibration{ [ ] () noexcept {
+				ClockCalibration c{ };
+				mqi64 qpf{ };
+				api::QueryPerformanceFrequency(&qpf);
+				c.tsc = InvariantTsc();
+				if (c.tsc) {
+					auto q0{ QpcTicks() };
+					auto t0{ TscTicks() };
+					auto q1{ q0 };
+					while (q1 - q0 < static_cast<mqui64>(qpf) / 100ULL) q1 = QpcTicks();
+					auto t1{ TscTicks() };
+					c.frequency = (t1 - t0) * static_cast<mqui64>(qpf) / (q1 - q0);
+				}
+				else {
+					c.frequency = static_cast<mqui64>(qpf);
+				}
+				c.toTimestamp = ClockScale(static_cast<mqui64>(TicksPerSecond), c.frequency);
+				c.toNanosecond = ClockScale(1000000000ULL, c.frequency);
+				c.wall = Timestamp{ };
+				c.origin = c.tsc ? TscTicks() : QpcTicks();
+				return c;
+			}() };
+			return calibration;
+		}
+	}
+
+	/// <summary>
+	/// <para>ʱӣCPUֲ֧ɱTSCʱȡRDTSCPʹQueryPerformanceCounter</para>
+	/// <para>ɻΪʱλ(100)룬״εʱУ׼һ</para>
+	/// </summary>
+	export struct MonotonicClock {
+		/// <summary>
+		/// ԭʼ
+		/// </summary>
+		[[nodiscard]] static mqui64 ticks() noexcept {
+			return details::Clock().tsc ? details::TscTicks() : details::QpcTicks();
+		}
+
+		/// <summary>
+		/// ÿ
+		/// </summary>
+		[[nodiscard]] static mqui64 frequency() noexcept {
+			return details::Clock().frequency;
+		}
+
+		/// <summary>
+		/// ǷʹTSC
+		/// </summary>
+		[[nodiscard]] static bool tsc() noexcept {
+			return details::Clock().tsc;
+		}
+
+		/// <summary>
+		/// Ϊʱλ(100)
+		/// </summary>
+		[[nodiscard]] static mqui64 duration(mqui64 delta) noexcept {
+			return details::ClockMul(delta, details::Clock().toTimestamp);
+		}
+
+		/// <summary>
+		/// Ϊ
+		/// </summary>
+		[[nodiscard]] static mqui64 nanoseconds(mqui64 delta) noexcept {
+			return details::ClockMul(delta, details::Clock().toNanosecond);
+		}
+
+		/// <summary>
+		/// ǰʱ䣬λΪ100룬ΪУ׼ʱ
+		/// </summary>
+		[[nodiscard]] static mqui64 now() noexcept {
+			return duration(ticks() - details::Clock().origin);
+		}
+
+		/// <summary>
+		/// У׼ȡõļΪϵͳʱ֮ϵͳʱӰ
+		/// </summary>
+		[[nodiscard]] static Timestamp timestamp(mqui64 ticks) noexcept {
+			auto& clock{ details::Clock() };
+			return Timestamp{ clock.wall + details::ClockMul(ticks - clock.origin, clock.toTimestamp) };
+		}
+	};
+
+	// MonotonicClock
+	export struct Stopwatch {
+	private:
+		mqui64 begin;
+	public:
+		Stopwatch() noexcept : begin{ MonotonicClock::ticks() } { }
+
+		/// <summary>
+		/// ¿ʼʱ
+		/// </summary>
+		void reset() noexcept {
+			begin = MonotonicClock::ticks();
+		}
+
+		/// <summary>
+		/// ԭʼ
+		/// </summary>
+		[[nodiscard]] mqui64 ticks() const noexcept {
+			return MonotonicClock::ticks() - begin;
+		}
+
+		/// <summary>
+		/// ʱ䣬λΪ100
+		/// </summary>
+		[[nodiscard]] mqui64 elapsed() const noexcept {
+			return MonotonicClock::duration(ticks());
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		[[nodiscard]] mqui64 nanoseconds() const noexcept {
+			return MonotonicClock::nanoseconds(ticks());
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		[[nodiscard]] double seconds() const noexcept {
+			return static_cast<double>(ticks()) / static_cast<double>(MonotonicClock::frequency());
+		}
+
+		/// <summary>
+		/// ȡʱ䲢¿ʼʱλΪ100
+		/// </summary>
+		mqui64 lap() noexcept {
+			auto now{ MonotonicClock::ticks() };
+			auto delta{ now - begin };
+			begin = now;
+			return MonotonicClock::duration(delta);
+		}
+	};
+
+	// ʱеһֱʱ
+	export struct TimeZoneType {
+		mqi32 offset; // UTCΪ
+		bool dst; // Ƿʱ
+		mqchara abbr[7]; // дCSTCEST
+
+		[[nodiscard]] std::string_view name() const noexcept {
+			mqui64 size{ };
+			while (size < sizeof(abbr) && abbr[size]) ++size;
+			return { abbr, size };
+		}
+	};
+
+	namespace details {
+		inline mqui32 TzRead32(mqcbytes p) noexcept {
+			return (static_cast<mqui32>(p[0]) << 24U) | (static_cast<mqui32>(p[1]) << 16U) | (static_cast<mqui32>(p[2]) << 8U) | p[3];
+		}
+
+		inline mqi64 TzRead64(mqcbytes p) noexcept {
+			return static_cast<mqi64>((static_cast<mqui64>(TzRead32(p)) << 32ULL) | TzRead32(p + 4));
+		}
+
+		// POSIX TZеڣM3.5.0J6059
+		struct TimeZoneDate {
+			mqchara kind; // 'M''J''D'
+			mqui32 month;
+			mqui32 week;
+			mqui32 day;
+			mqi32 time; // ʱĬΪ02:00:00
+		};
+
+		// TZifĩβPOSIX TZCET-1CEST,M3.5.0,M10.5.0/3һ֮ʱ
+		struct TimeZoneRule {
+			TimeZoneType std;
+			TimeZoneType dst;
+			TimeZoneDate start;
+			TimeZoneDate end;
+			bool hasDst;
+		};
+
+		inline bool TzParseName(std::string_view& sv, TimeZoneType& type) noexcept {
+			mqui64 size{ };
+			std::string_view name;
+			if (!sv.empty() && sv.front() == '<') {
+				size = sv.find('>');
+				if (size == std::string_view::npos) return false;
+				name = sv.substr(1ULL, size - 1ULL);
+				++size;
+			}
+			else {
+				while (size < sv.size() && ((sv[size] >= 'A' && sv[size] <= 'Z') || (sv[size] >= 'a' && sv[size] <= 'z'))) ++size;
+				name = sv.substr(0ULL, size);
+			}
+			if (name.size() < 3ULL) return false;
+			freestanding::copy(type.abbr, name.data(), name.size() < sizeof(type.abbr) ? name.size() : sizeof(type.abbr));
+			sv.remove_prefix(size);
+			return true;
+		}
+
+		inline bool TzParseNumber(std::string_view& sv, mqui32& value) noexcept {
+			if (sv.empty() || sv.front() < '0' || sv.front() > '9') return false;
+			value = 0U;
+			while (!sv.empty() && sv.front() >= '0' && sv.front() <= '9') {
+				value = value * 10U + static_cast<mqui32>(sv.front() - '0');
+				sv.remove_prefix(1ULL);
+			}
+			return true;
+		}
+
+		// [+-]hh[:mm[:ss]]
+		inline bool TzParseTime(std::string_view& sv, mqi32& seconds) noexcept {
+			mqi32 sign{ 1 };
+			if (!sv.empty() && (sv.front() == '+' || sv.front() == '-')) {
+				if (sv.front() == '-') sign = -1;
+				sv.remove_prefix(1ULL);
+			}
+			mqui32 h{ }, m{ }, s{ };
+			if (!TzParseNumber(sv, h)) return false;
+			if (!sv.empty() && sv.front() == ':') {
+				sv.remove_prefix(1ULL);
+				if (!TzParseNumber(sv, m)) return false;
+				if (!sv.empty() && sv.front() == ':') {
+					sv.remove_prefix(1ULL);
+					if (!TzParseNumber(sv, s)) return false;
+				}
+			}
+			seconds = sign * static_cast<mqi32>(h * 3600U + m * 60U + s);
+			return true;
+		}
+
+		inline bool TzParseDate(std::string_view& sv, TimeZoneDate& date) noexcept {
+			if (sv.empty() || sv.front() != ',') return false;
+			sv.remove_prefix(1ULL);
+			date = { };
+			date.time = 7200;
+			if (!sv.empty() && sv.front() == 'M') {
+				sv.remove_prefix(1ULL);
+				date.kind = 'M';
+				if (!TzParseNumber(sv, date.month) || sv.empty() || sv.front() != '.') return false;
+				sv.remove_prefix(1ULL);
+				if (!TzParseNumber(sv, date.week) || sv.empty() || sv.front() != '.') return false;
+				sv.remove_prefix(1ULL);
+				if (!TzParseNumber(sv, date.day)) return false;
+				if (date.month < 1U || date.month > 12U || date.week < 1U || date.week > 5U || date.day > 6U) return false;
+			}
+			else {
+				date.kind = 'D';
+				if (!sv.empty() && sv.front() == 'J') {
+					sv.remove_prefix(1ULL);
+					date.kind = 'J';
+				}
+				if (!TzParseNumber(sv, date.day) || date.day > 365U || (date.kind == 'J' && date.day == 0U)) return false;
+			}
+			if (!sv.empty() && sv.front() == '/') {
+				sv.remove_prefix(1ULL);
+				if (!TzParseTime(sv, date.time)) return false;
+			}
+			return true;
+		}
+
+		inline bool TzParseRule(std::string_view sv, TimeZoneRule& rule) noexcept {
+			rule = { };
+			mqi32 offset{ };
+			if (!TzParseName(sv, rule.std) || !TzParseTime(sv, offset)) return false;
+			rule.std.offset = -offset; // POSIXΪ
+			if (sv.empty()) return true;
+			if (!TzParseName(sv, rule.dst)) return false;
+			rule.dst.dst = true;
+			rule.dst.offset = rule.std.offset + 3600;
+			if (!sv.empty() && sv.front() != ',') {
+				if (!TzParseTime(sv, offset)) return false;
+				rule.dst.offset = -offset;
+			}
+			if (sv.empty()) { // ޹ʱ
+				rule.start = { 'M', 3U, 2U, 0U, 7200 };
+				rule.end = { 'M', 11U, 1U, 0U, 7200 };
+			}
+			else if (!TzParseDate(sv, rule.start) || !TzParseDate(sv, rule.end) || !sv.empty()) {
+				return false;
+			}
+			rule.hasDst = true;
+			return true;
+		}
+
+		inline constexpr bool TzLeapYear(mqi64 y) noexcept {
+			return y % 4LL == 0LL && (y % 100LL != 0LL || y % 400LL == 0LL);
+		}
+
+		// ymµ
+		inline constexpr mqui32 TimeMonthDays(mqi64 y, mqui32 m) noexcept {
+			constexpr mqui32 MonthDays[]{ 31U, 28U, 31U, 30U, 31U, 30U, 31U, 31U, 30U, 31U, 30U, 31U };
+			return MonthDays[m - 1U] + (m == 2U && TzLeapYear(y) ? 1U : 0U);
+		}
+
+		// yĵ(1970-01-01 00:00:00)
+		inline mqi64 TzRuleLocal(TimeZoneDate const& date, mqi64 y) noexcept {
+			mqi64 days{ };
+			if (date.kind == 'M') {
+				auto first{ DaysFromCivil(y, date.month, 1U) };
+				auto day{ (date.day + 7U - WeekdayFromDays(first)) % 7U + (date.week - 1U) * 7U };
+				if (day >= TimeMonthDays(y, date.month)) day -= 7U;
+				days = first + day;
+			}
+			else {
+				days = DaysFromCivil(y, 1U, 1U);
+				if (date.kind == 'J') days += date.day - 1U + (TzLeapYear(y) && date.day >= 60U ? 1U : 0U);
+				else days += date.day;
+			}
+			return days * 86400LL + date.time;
+		}
+
+		inline TimeZoneType const& TzRuleType(TimeZoneRule const& rule, mqi64 seconds) noexcept {
+			if (!rule.hasDst) return rule.std;
+			mqi64 y{ };
+			mqui32 m{ }, d{ };
+			CivilFromDays(FloorDiv(seconds + rule.std.offset, 86400LL), y, m, d);
+			auto start{ TzRuleLocal(rule.start, y) - rule.std.offset };
+			auto end{ TzRuleLocal(rule.end, y) - rule.dst.offset };
+			bool dst{ start < end ? (seconds >= start && seconds < end) : !(seconds >= end && seconds < start) };
+			return dst ? rule.dst : rule.std;
+		}
+	}
+
+	namespace details {
+		// ʱݿ⣬ֶΪСˣ8ֽڶ룬ֱӳʹ
+		// ļͷ | Ŀ¼ |  | ʱ¼
+		// ʱ¼: TimeZoneRecord | ʱmqi64[count] | TimeZoneType[typeCount] | ±mqbyte[count] | POSIX TZ
+		constexpr mqui32 TimeZoneMagic{ 0x5A54514DU }; // MQTZ
+		constexpr mqui32 TimeZoneVersion{ 1U };
+
+		struct TimeZoneHeader {
+			mqui32 magic;
+			mqui32 version;
+			mqui32 count; // ʱ
+			mqui32 reserved;
+		};
+
+		struct TimeZoneEntry {
+			mqui32 name; // ƫƣASCII
+			mqui32 nameSize;
+			mqui32 offset; // ¼ƫ
+			mqui32 size; // ¼ֽ
+		};
+
+		struct TimeZoneRecord {
+			mqui32 count; // 
+			mqui16 typeCount;
+			mqui16 ruleSize;
+		};
+
+		static_assert(sizeof(TimeZoneHeader) == 16ULL && sizeof(TimeZoneEntry) == 16ULL && sizeof(TimeZoneRecord) == 8ULL && sizeof(TimeZoneType) == 12ULL);
+
+		inline constexpr mqui64 TzAlign(mqui64 size) noexcept {
+			return (size + 7ULL) & ~7ULL;
+		}
+
+		inline constexpr mqui64 TzRecordSize(mqui64 count, mqui64 typeCount, mqui64 ruleSize) noexcept {
+			return sizeof(TimeZoneRecord) + count * (sizeof(mqi64) + 1ULL) + typeCount * sizeof(TimeZoneType) + ruleSize;
+		}
+
+		// ƱȽϣݿеΪASCII
+		inline mqi32 TzCompare(std::wstring_view name, mqcbytes other, mqui64 size) noexcept {
+			for (mqui64 i{ }; i < name.size() && i < size; ++i) {
+				if (static_cast<mqui32>(name[i]) != other[i]) return static_cast<mqui32>(name[i]) < other[i] ? -1 : 1;
+			}
+			return name.size() == size ? 0 : (name.size() < size ? -1 : 1);
+		}
+
+		// TZif
+		struct TzInfo {
+			mqlist<mqi64> transitions;
+			mqlist<mqbyte> indexes;
+			mqlist<TimeZoneType> types;
+			std::string_view rule;
+		};
+
+		// TZifݣv2ϰ汾ʹ64λݿĩβPOSIX TZϢ
+		inline bool TzParse(mqcbytes data, mqui64 size, TzInfo& info) noexcept {
+			auto header = [&](mqcbytes p, mqui32* counts) noexcept {
+				if (p + 44 > data + size || p[0] != 'T' || p[1] != 'Z' || p[2] != 'i' || p[3] != 'f') return false;
+				for (mqui32 i{ }; i < 6U; ++i) counts[i] = TzRead32(p + 20 + i * 4U);
+				return true;
+			};
+			// isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt
+			mqui32 c[6]{ };
+			if (!header(data, c)) return false;
+			mqcbytes p{ data + 44 };
+			mqui64 timeSize{ 4ULL }, leapSize{ 8ULL };
+			if (data[4] >= '2') { // v1ݿ
+				p += c[3] * 5ULL + c[4] * 6ULL + c[5] + c[2] * 8ULL + c[1] + c[0];
+				if (!header(p, c)) return false;
+				p += 44;
+				timeSize = 8ULL;
+				leapSize = 12ULL;
+			}
+			auto blockSize{ c[3] * (timeSize + 1ULL) + c[4] * 6ULL + c[5] + c[2] * leapSize + c[1] + c[0] };
+			if (c[4] == 0U || c[4] > 256U || p + blockSize > data + size) return false;
+			mqcbytes pTimes{ p };
+			mqcbytes pIndexes{ pTimes + c[3] * timeSize };
+			mqcbytes pTypes{ pIndexes + c[3] };
+			mqcbytes pChars{ pTypes + c[4] * 6ULL };
+			info.transitions.reserve(c[3]);
+			info.indexes.reserve(c[3]);
+			info.types.reserve(c[4]);
+			for (mqui32 i{ }; i < c[3]; ++i) {
+				info.transitions.add(timeSize == 8ULL ? TzRead64(pTimes + i * 8ULL) : static_cast<mqi32>(TzRead32(pTimes + i * 4ULL)));
+				if (pIndexes[i] >= c[4] || (i && info.transitions[i] <= info.transitions[i - 1U])) return false;
+				info.indexes.add(pIndexes[i]);
+			}
+			for (mqui32 i{ }; i < c[4]; ++i) {
+				mqcbytes t{ pTypes + i * 6ULL };
+				TimeZoneType type{ static_cast<mqi32>(TzRead32(t)), t[4] != 0U, { } };
+				if (t[5] >= c[5]) return false;
+				for (mqui32 j{ t[5] }, k{ }; j < c[5] && pChars[j] && k < sizeof(type.abbr); ++j, ++k) {
+					type.abbr[k] = static_cast<mqchara>(pChars[j]);
+				}
+				info.types.add(type);
+			}
+			if (timeSize == 8ULL) { // ĩβĹ\nCET-1CEST,M3.5.0,M10.5.0/3\n
+				mqcbytes footer{ p + blockSize };
+				if (footer < data + size && *footer == '\n') {
+					std::string_view sv{ reinterpret_cast<mqcstra>(footer + 1), static_cast<mqui64>(data + size - footer - 1) };
+					if (auto end{ sv.find('\n') }; end != std::string_view::npos && end != 0ULL) {
+						TimeZoneRule rule;
+						info.rule = sv.substr(0ULL, end);
+						if (info.rule.size() > 0xFFFFULL || !TzParseRule(info.rule, rule)) return false;
+					}
+				}
+			}
+			return true;
+		}
+	}
+
+	/// <summary>
+	/// <para>ʱʱݿеļ¼ʱͲƣݿڼЧ</para>
+	/// <para>ʱ̶ֲңϴе䣬תͬһڵʱֻȽ</para>
+	/// <para>һ֮POSIX TZʱ</para>
+	/// </summary>
+	export struct TimeZone {
+	private:
+		mqi64 const* transitions{ }; // ʱ̣UTC
+		mqbyte const* indexes{ }; // ֮
+		TimeZoneType const* types{ };
+		mqui64 count{ };
+		details::TimeZoneRule rule{ }; // ¼ʱֻʹù
+		bool hasRule{ };
+		mutable std::atomic<mqui64> cache{ }; // ϴе±
+
+		friend struct TimeZoneDatabase;
+
+		TimeZoneType const& _type(mqi64 seconds) const noexcept {
+			if (!types || (count != 0ULL && seconds >= transitions[count - 1ULL] && hasRule)) {
+				return details::TzRuleType(rule, seconds);
+			}
+			if (count == 0ULL || seconds < transitions[0]) {
+				return count == 0ULL && hasRule ? details::TzRuleType(rule, seconds) : types[0];
+			}
+			auto i{ cache.load(std::memory_order_relaxed) };
+			if (i >= count || seconds < transitions[i] || (i + 1ULL < count && seconds >= transitions[i + 1ULL])) {
+				mqui64 lo{ }, hi{ count }; // һseconds
+				while (hi - lo > 1ULL) {
+					auto mid{ (lo + hi) / 2ULL };
+					if (transitions[mid] <= seconds) lo = mid;
+					else hi = mid;
+				}
+				i = lo;
+				cache.store(i, std::memory_order_relaxed);
+			}
+			return types[indexes[i]];
+		}
+
+		// ݿеʱ¼Уͨ޸
+		bool _load(mqcbytes data, mqui64 size) noexcept {
+			if (size < sizeof(details::TimeZoneRecord)) return false;
+			details::TimeZoneRecord record;
+			freestanding::copy(&record, data, sizeof(details::TimeZoneRecord));
+			if (record.typeCount == 0U || record.typeCount > 256U || size < details::TzRecordSize(record.count, record.typeCount, record.ruleSize)) return false;
+			auto newTransitions{ reinterpret_cast<mqi64 const*>(data + sizeof(details::TimeZoneRecord)) };
+			auto newTypes{ reinterpret_cast<TimeZoneType const*>(newTransitions + record.count) };
+			auto newIndexes{ reinterpret_cast<mqbyte const*>(newTypes + record.typeCount) };
+			for (mqui64 i{ }; i < record.count; ++i) {
+				if (newIndexes[i] >= record.typeCount || (i && newTransitions[i] <= newTransitions[i - 1ULL])) return false;
+			}
+			details::TimeZoneRule newRule{ };
+			if (record.ruleSize && !details::TzParseRule({ reinterpret_cast<mqcstra>(newIndexes + record.count), record.ruleSize }, newRule)) return false;
+			transitions = newTransitions;
+			indexes = newIndexes;
+			types = newTypes;
+			count = record.count;
+			rule = newRule;
+			hasRule = record.ruleSize != 0U;
+			cache.store(0ULL, std::memory_order_relaxed);
+			return true;
+		}
+	public:
+		/// <summary>
+		/// UTC
+		/// </summary>
+		TimeZone() noexcept {
+			rule.std = TimeZoneType{ 0, false, { 'U', 'T', 'C' } };
+		}
+
+		TimeZone(TimeZone const& tz) noexcept : transitions{ tz.transitions }, indexes{ tz.indexes }, types{ tz.types },
+			count{ tz.count }, rule{ tz.rule }, hasRule{ tz.hasRule } { }
+
+		TimeZone& operator = (TimeZone const& tz) noexcept {
+			if (this != &tz) {
+				transitions = tz.transitions;
+				indexes = tz.indexes;
+				types = tz.types;
+				count = tz.count;
+				rule = tz.rule;
+				hasRule = tz.hasRule;
+				cache.store(0ULL, std::memory_order_relaxed);
+			}
+			return *this;
+		}
+
+		/// <summary>
+		/// ̶ƫƵʱ
+		/// </summary>
+		/// <param name="offset">UTCΪ</param>
+		[[nodiscard]] static TimeZone Fixed(mqi32 offset) noexcept {
+			TimeZone tz;
+			tz.rule.std.offset = offset;
+			return tz;
+		}
+
+		/// <summary>
+		/// ʱڵıʱ
+		/// </summary>
+		[[nodiscard]] TimeZoneType type(Timestamp ts) const noexcept {
+			return _type(details::FloorDiv(static_cast<mqi64>(static_cast<mqui64>(ts)), details::TicksPerSecond));
+		}
+
+		/// <summary>
+		/// ʱUTC
+		/// </summary>
+		[[nodiscard]] mqi32 offset(Timestamp ts) const noexcept {
+			return type(ts).offset;
+		}
+
+		/// <summary>
+		/// ʱΪʱıʱ
+		/// </summary>
+		[[nodiscard]] Time local(Timestamp ts) const noexcept {
+			return ts.local(static_cast<Timestamp::Zone>(static_cast<mqui64>(static_cast<mqi64>(offset(ts)) * details::TicksPerSecond)));
+		}
+
+		/// <summary>
+		/// ʱ任Ϊʱʱʼʱʱ䰴ǰƫƼ㣬ʱظʱȡһ
+		/// </summary>
+		[[nodiscard]] Timestamp timestamp(Time const& t) const noexcept {
+			auto utc{ static_cast<mqui64>(Timestamp{ t, static_cast<Timestamp::Zone>(0ULL) }) };
+			constexpr auto day{ static_cast<mqui64>(details::TicksPerDay) };
+			// ǰһƫƼĺѡƫ
+			auto before{ offset(Timestamp{ utc - day }) }, after{ offset(Timestamp{ utc + day }) };
+			auto at = [&](mqi32 off) noexcept {
+				return Timestamp{ utc - static_cast<mqui64>(static_cast<mqi64>(off) * details::TicksPerSecond) };
+			};
+			// ظʱƫƶƫƴǰ
+			auto first{ before > after ? before : after }, second{ before > after ? after : before };
+			if (offset(at(first)) == first) return at(first);
+			if (offset(at(second)) == second) return at(second);
+			return at(before);
+		}
+	};
+
+	// ʱԴnameΪIANAƣAsia/ShanghaidataΪTZif
+	export struct TimeZoneSource {
+		std::wstring_view name;
+		mqcbytes data;
+		mqui64 size;
+	};
+
+	/// <summary>
+	/// <para>ʱݿ⣬͵ؽCompileֽڼʺֱڴӳļ</para>
+	/// <para>BuiltinΪģĲʱϵͳʱӿzoneinfoĿ¼</para>
+	/// <para>ݿڼԭ뱣Ч8ֽڶ</para>
+	/// </summary>
+	export struct TimeZoneDatabase {
+	private:
+		mqcbytes base{ };
+		mqui64 bytes{ };
+		mqui32 count{ };
+
+		[[nodiscard]] details::TimeZoneEntry _entry(mqui32 index) const noexcept {
+			details::TimeZoneEntry entry;
+			freestanding::copy(&entry, base + sizeof(details::TimeZoneHeader) + index * sizeof(details::TimeZoneEntry), sizeof(details::TimeZoneEntry));
+			return entry;
+		}
+	public:
+		TimeZoneDatabase() = default;
+
+		// ֽڼ
+		TimeZoneDatabase(mqcbytes data, mqui64 size) noexcept {
+			load(data, size);
+		}
+
+		/// <summary>
+		/// ʱݿ⣬УļͷĿ¼ʱ¼ڲʱУ
+		/// </summary>
+		/// <param name="data">ݣ8ֽڶ</param>
+		/// <param name="size">ֽ</param>
+		/// <returns>ǷϷʧʱݿΪ</returns>
+		bool load(mqcbytes data, mqui64 size) noexcept {
+			base = nullptr;
+			bytes = 0ULL;
+			count = 0U;
+			details::TimeZoneHeader header;
+			if (reinterpret_cast<mqui64>(data) % 8ULL != 0ULL || size < sizeof(header)) return false;
+			freestanding::copy(&header, data, sizeof(header));
+			if (header.magic != details::TimeZoneMagic || header.version != details::TimeZoneVersion) return false;
+			if (header.count > (size - sizeof(header)) / sizeof(details::TimeZoneEntry)) return false;
+			base = data;
+			bytes = size;
+			for (mqui32 i{ }; i < header.count; ++i) {
+				auto entry{ _entry(i) };
+				if (entry.name > size || entry.nameSize > size - entry.name || entry.offset > size || entry.size > size - entry.offset || entry.offset % 8U != 0U) {
+					base = nullptr;
+					bytes = 0ULL;
+					return false;
+				}
+			}
+			count = header.count;
+			return true;
+		}
+
+		/// <summary>
+		/// ģĲʱ
+		/// </summary>
+		[[nodiscard]] static TimeZoneDatabase const& Builtin() noexcept {
+			static TimeZoneDatabase const database{ details::TimeZoneData, sizeof(details::TimeZoneData) };
+			return database;
+		}
+
+		/// <summary>
+		/// ʱ
+		/// </summary>
+		[[nodiscard]] mqui32 size() const noexcept {
+			return count;
+		}
+
+		/// <summary>
+		/// ĵindexʱ
+		/// </summary>
+		[[nodiscard]] std::string_view name(mqui32 index) const noexcept {
+			if (index >= count) return { };
+			auto entry{ _entry(index) };
+			return { reinterpret_cast<mqcstra>(base + entry.name), entry.nameSize };
+		}
+
+		/// <summary>
+		/// IANAƲʱִСд
+		/// </summary>
+		/// <param name="name">ʱAsia/Shanghai</param>
+		/// <param name="zone">ҵʱݿеļ¼</param>
+		/// <returns>Ҽ¼Ϸtruezone</returns>
+		[[nodiscard]] bool find(std::wstring_view name, TimeZone& zone) const noexcept {
+			mqui32 lo{ }, hi{ count };
+			while (lo < hi) {
+				auto mid{ lo + (hi - lo) / 2U };
+				auto entry{ _entry(mid) };
+				auto cmp{ details::TzCompare(name, base + entry.name, entry.nameSize) };
+				if (cmp == 0) return zone._load(base + entry.offset, entry.size);
+				if (cmp < 0) hi = mid;
+				else lo = mid + 1U;
+			}
+			return false;
+		}
+
+		/// <summary>
+		/// TZif(RFC 8536zic/usr/share/zoneinfoļ)ʱݿ
+		/// </summary>
+		/// <param name="sources">ʱTZifݣΪASCIIҲظ</param>
+		/// <returns>ݿֽڼһݲϷʱΪ</returns>
+		[[nodiscard]] static mqarray<mqbyte> Compile(mqlist<TimeZoneSource> const& sources) noexcept {
+			auto total{ sources.size() };
+			mqarray<details::TzInfo> infos(total);
+			mqarray<mqui64> order(total);
+			mqui64 size{ sizeof(details::TimeZoneHeader) + total * sizeof(details::TimeZoneEntry) };
+			for (mqui64 i{ }; i < total; ++i) {
+				auto& source{ sources[i] };
+				if (source.name.empty() || source.name.size() > 0xFFFFULL || !details::TzParse(source.data, source.size, infos[i])) return { };
+				for (auto c : source.name) {
+					if (c < 0x20 || c > 0x7E) return { };
+				}
+				order[i] = i;
+				size += source.name.size();
+			}
+			std::sort(order.begin(), order.end(), [&](mqui64 a, mqui64 b) noexcept {
+				return sources[a].name < sources[b].name;
+				});
+			for (mqui64 i{ 1ULL }; i < total; ++i) {
+				if (sources[order[i]].name == sources[order[i - 1ULL]].name) return { };
+			}
+			size = details::TzAlign(size);
+			for (auto& info : infos) {
+				size += details::TzAlign(details::TzRecordSize(info.transitions.size(), info.types.size(), info.rule.size()));
+			}
+			if (size > 0xFFFFFFFFULL) return { };
+			mqarray<mqbyte> bin(size);
+			details::TimeZoneHeader header{ details::TimeZoneMagic, details::TimeZoneVersion, static_cast<mqui32>(total), 0U };
+			freestanding::copy(bin.data(), &header, sizeof(header));
+			auto name{ sizeof(details::TimeZoneHeader) + total * sizeof(details::TimeZoneEntry) };
+			auto offset{ name };
+			for (mqui64 i{ }; i < total; ++i) {
+				offset += sources[i].name.size();
+			}
+			offset = details::TzAlign(offset);
+			for (mqui64 i{ }; i < total; ++i) {
+				auto& source{ sources[order[i]] };
+				auto& info{ infos[order[i]] };
+				auto recordSize{ details::TzRecordSize(info.transitions.size(), info.types.size(), info.rule.size()) };
+				details::TimeZoneEntry entry{ static_cast<mqui32>(name), static_cast<mqui32>(source.name.size()), static_cast<mqui32>(offset), static_cast<mqui32>(recordSize) };
+				freestanding::copy(bin.data() + sizeof(details::TimeZoneHeader) + i * sizeof(details::TimeZoneEntry), &entry, sizeof(entry));
+				for (auto c : source.name) {
+					bin[name++] = static_cast<mqbyte>(c);
+				}
+				details::TimeZoneRecord record{ static_cast<mqui32>(info.transitions.size()), static_cast<mqui16>(info.types.size()), static_cast<mqui16>(info.rule.size()) };
+				auto p{ bin.data() + offset };
+				freestanding::copy(p, &record, sizeof(record));
+				p += sizeof(record);
+				if (record.count) {
+					freestanding::copy(p, info.transitions.data(), record.count * sizeof(mqi64));
+					p += record.count * sizeof(mqi64);
+				}
+				freestanding::copy(p, info.types.data(), record.typeCount * sizeof(TimeZoneType));
+				p += record.typeCount * sizeof(TimeZoneType);
+				if (record.count) {
+					freestanding::copy(p, info.indexes.data(), record.count);
+					p += record.count;
+				}
+				if (record.ruleSize) {
+					freestanding::copy(p, info.rule.data(), record.ruleSize);
+				}
+				offset += details::TzAlign(recordSize);
+			}
+			return bin;
+		}
+	};
+
+	namespace details {
+		// ĸֶΣoffsetΪʽʱƫ(100ns)
+		struct TimeFields {
+			mqi64 year;
+			mqui32 month;
+			mqui32 day;
+			mqi64 seconds; // 
+			mqi64 fraction; // µ100ns
+			mqi64 offset;
+			bool zoned;
+		};
+
+		// 8ֽڶ֣dΪ֣?Ϊ飬Ϊͬķָ
+		struct TimeLayout {
+			mqui64 digits;
+			mqui64 separators;
+			mqui64 value;
+		};
+
+		inline constexpr TimeLayout TimeMakeLayout(char const (&layout)[9]) noexcept {
+			TimeLayout l{ };
+			for (mqui32 i{ }; i < 8U; ++i) {
+				if (layout[i] == 'd') l.digits |= 0xFFULL << (i * 8U);
+				else if (layout[i] != '?') {
+					l.separators |= 0xFFULL << (i * 8U);
+					l.value |= static_cast<mqui64>(layout[i]) << (i * 8U);
+				}
+			}
+			return l;
+		}
+
+		constexpr auto TimeLayoutDate{ TimeMakeLayout("dddd-dd-") };
+		constexpr auto TimeLayoutDay{ TimeMakeLayout("dd??????") };
+		constexpr auto TimeLayoutTime{ TimeMakeLayout("dd?dd:dd") };
+
+		// һμ8ַǷϲ
+		inline constexpr bool TimeCheck(mqui64 w, TimeLayout const& l) noexcept {
+			auto d{ w & l.digits };
+			return (d & 0xF0F0F0F0F0F0F0F0ULL) == (0x3030303030303030ULL & l.digits) &&
+				((d + 0x0606060606060606ULL) & l.digits & 0xF0F0F0F0F0F0F0F0ULL) == (0x3030303030303030ULL & l.digits) &&
+				(w & l.separators) == l.value;
+		}
+
+		// ֽΪλһλɵλ
+		inline constexpr mqui64 TimePairs(mqui64 w, TimeLayout const& l) noexcept {
+			auto x{ w & l.digits & 0x0F0F0F0F0F0F0F0FULL };
+			return x * 10ULL + (x >> 8ULL);
+		}
+
+		inline constexpr mqui32 TimeLane(mqui64 w, mqui32 i) noexcept {
+			return static_cast<mqui32>((w >> (i * 8U)) & 0xFFULL);
+		}
+
+		// ȡǰ16ַ64λַѹΪֽڣASCIIַᱻΪָֻ
+		template<time_char Char>
+		inline void TimeLoad(Char const* p, mqui64 size, mqui64& w0, mqui64& w1) noexcept {
+			Char buf[16ULL]{ };
+			if (size < 16ULL) {
+				freestanding::copy(buf, p, size * sizeof(Char));
+				p = buf;
+			}
+			if constexpr (sizeof(Char) == 1ULL) {
+				freestanding::copy(&w0, p, 8ULL);
+				freestanding::copy(&w1, p + 8, 8ULL);
+			}
+			else {
+				auto packed{ _mm_packus_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)),
+					_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + 8))) };
+				w0 = static_cast<mqui64>(_mm_cvtsi128_si64(packed));
+				w1 = static_cast<mqui64>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(packed, packed)));
+			}
+		}
+
+		template<time_char Char>
+		inline constexpr bool TimeDigit(Char c) noexcept {
+			return c >= static_cast<Char>('0') && c <= static_cast<Char>('9');
+		}
+
+		// µС7λλȥ±ȷھֲ⾭дغضַ
+		template<time_char Char>
+		inline bool TimeParseFraction(Char const* p, mqui64 size, mqui64& i, mqi64& fraction) noexcept {
+			mqui64 j{ i }, value{ };
+			if (j == size || !TimeDigit(p[j])) return false;
+			for (; j < size && j - i < 7ULL && TimeDigit(p[j]); ++j) {
+				value = value * 10ULL + static_cast<mqui64>(p[j] - static_cast<Char>('0'));
+			}
+			fraction = static_cast<mqi64>(value * BASE10POW[7ULL - (j - i)]);
+			while (j < size && TimeDigit(p[j])) ++j;
+			i = j;
+			return true;
+		}
+
+		// ZHH[:]MMHH
+		template<time_char Char>
+		inline bool TimeParseZone(Char const* p, mqui64 size, mqui64& i, mqi64& offset) noexcept {
+			mqui64 j{ i };
+			if (j == size) return false;
+			if (p[j] == static_cast<Char>('Z') || p[j] == static_cast<Char>('z')) {
+				i = j + 1ULL;
+				offset = 0LL;
+				return true;
+			}
+			if (p[j] != static_cast<Char>('+') && p[j] != static_cast<Char>('-')) return false;
+			mqi64 sign{ p[j++] == static_cast<Char>('-') ? -1LL : 1LL };
+			if (size - j < 2ULL || !TimeDigit(p[j]) || !TimeDigit(p[j + 1ULL])) return false;
+			mqi64 h{ (p[j] - static_cast<Char>('0')) * 10LL + (p[j + 1ULL] - static_cast<Char>('0')) }, m{ };
+			j += 2ULL;
+			bool colon{ j < size && p[j] == static_cast<Char>(':') };
+			if (colon) ++j;
+			if (size - j >= 2ULL && TimeDigit(p[j]) && TimeDigit(p[j + 1ULL])) {
+				m = (p[j] - static_cast<Char>('0')) * 10LL + (p[j + 1ULL] - static_cast<Char>('0'));
+				j += 2ULL;
+			}
+			else if (colon) return false;
+			if (h > 23LL || m > 59LL) return false;
+			i = j;
+			offset = sign * (h * 3600LL + m * 60LL) * TicksPerSecond;
+			return true;
+		}
+
+		// YYYY-MM-DD[(T|t| )HH:MM[:SS[(.|,)f...]][Z|HH[:MM]]]
+		template<time_char Char>
+		inline bool TimeParseISO(Char const* p, mqui64 size, TimeFields& f) noexcept {
+			if (size < 10ULL) return false;
+			mqui64 w0, w1;
+			TimeLoad(p, size, w0, w1);
+			if (!TimeCheck(w0, TimeLayoutDate)) return false;
+			auto date{ TimePairs(w0, TimeLayoutDate) };
+			mqi64 year{ TimeLane(date, 0U) * 100LL + TimeLane(date, 2U) }, seconds{ }, fraction{ }, offset{ };
+			mqui32 month{ TimeLane(date, 5U) }, day{ };
+			bool zoned{ };
+			mqui64 i{ 10ULL };
+			if (size == 10ULL) {
+				if (!TimeCheck(w1, TimeLayoutDay)) return false;
+				day = TimeLane(TimePairs(w1, TimeLayoutDay), 0U);
+			}
+			else {
+				if (size < 16ULL || !TimeCheck(w1, TimeLayoutTime)) return false;
+				auto sep{ p[10] };
+				if (sep != static_cast<Char>('T') && sep != static_cast<Char>('t') && sep != static_cast<Char>(' ')) return false;
+				auto time{ TimePairs(w1, TimeLayoutTime) };
+				day = TimeLane(time, 0U);
+				auto hour{ TimeLane(time, 3U) }, minute{ TimeLane(time, 6U) }, second{ 0U };
+				i = 16ULL;
+				if (size - i >= 3ULL && p[i] == static_cast<Char>(':') && TimeDigit(p[i + 1ULL]) && TimeDigit(p[i + 2ULL])) {
+					second = static_cast<mqui32>((p[i + 1ULL] - static_cast<Char>('0')) * 10 + (p[i + 2ULL] - static_cast<Char>('0')));
+					i += 3ULL;
+					if (i < size && (p[i] == static_cast<Char>('.') || p[i] == static_cast<Char>(','))) {
+						++i;
+						if (!TimeParseFraction(p, size, i, fraction)) return false;
+					}
+				}
+				if (hour > 23U || minute > 59U || second > 60U) return false;
+				seconds = hour * 3600LL + minute * 60LL + second;
+				if (i < size) {
+					if (!TimeParseZone(p, size, i, offset)) return false;
+					zoned = true;
+				}
+			}
+			if (i != size || month < 1U || month > 12U || day < 1U || day > TimeMonthDays(year, month)) return false;
+			f = { year, month, day, seconds, fraction, offset, zoned };
+			return true;
+		}
+
+		// ڻĻ棬ͬһڵʱͬһ
+		struct TimeDayCache {
+			mqi64 key{ -1LL };
+			mqi64 days{ };
+
+			mqi64 operator () (TimeFields const& f) noexcept {
+				auto k{ (f.year << 9LL) | (f.month << 5U) | f.day };
+				if (k != key) {
+					key = k;
+					days = DaysFromCivil(f.year, f.month, f.day);
+				}
+				return days;
+			}
+		};
+
+		inline Timestamp TimeCombine(TimeFields const& f, mqi64 days, Timestamp::Zone zone) noexcept {
+			auto ticks{ (days * 86400LL + f.seconds) * TicksPerSecond + f.fraction };
+			return Timestamp{ static_cast<mqui64>(ticks) - (f.zoned ? static_cast<mqui64>(f.offset) : static_cast<mqui64>(zone)) };
+		}
+	}
+
+	/// <summary>
+	/// <para>ISO-8601/RFC-3339ʱ䣬2024-01-23T22:38:49.012+08:002024-01-23 22:38:49Z2024-01-23</para>
+	/// <para>ʱְһμ8ַ롢СʱѡС7λ</para>
+	/// </summary>
+	/// <param name="str">ַ</param>
+	/// <param name="size">ַ</param>
+	/// <param name="ts"></param>
+	/// <param name="zone">ַδʱʱõʱ</param>
+	/// <returns>Ƿɹʧʱts</returns>
+	export template<details::time_char Char>
+	[[nodiscard]] inline bool ParseTimestamp(Char const* str, mqui64 size, Timestamp& ts, Timestamp::Zone zone = Timestamp::Zone::CN_BEIJING) noexcept {
+		details::TimeFields f;
+		if (!details::TimeParseISO(str, size, f)) return false;
+		ts = details::TimeCombine(f, details::DaysFromCivil(f.year, f.month, f.day), zone);
+		return true;
+	}
+
+	export template<details::time_char Char>
+	[[nodiscard]] inline bool ParseTimestamp(std::basic_string_view<Char> str, Timestamp& ts, Timestamp::Zone zone = Timestamp::Zone::CN_BEIJING) noexcept {
+		return ParseTimestamp(str.data(), str.size(), ts, zone);
+	}
+
+	/// <summary>
+	/// һISO-8601/RFC-3339ʱ䣬ͬյʱڻ
+	/// </summary>
+	/// <param name="strs">ַ</param>
+	/// <param name="count"></param>
+	/// <param name="out">飬ʧܵλд0</param>
+	/// <param name="zone">ַδʱʱõʱ</param>
+	/// <returns>ɹĸ</returns>
+	export template<details::time_char Char>
+	inline mqui64 ParseTimestamps(std::basic_string_view<Char> const* strs, mqui64 count, Timestamp* out, Timestamp::Zone zone = Timestamp::Zone::CN_BEIJING) noexcept {
+		details::TimeDayCache cache;
+		details::TimeFields f;
+		mqui64 parsed{ };
+		for (mqui64 i{ }; i < count; ++i) {
+			if (details::TimeParseISO(strs[i].data(), strs[i].size(), f)) {
+				out[i] = details::TimeCombine(f, cache(f), zone);
+				++parsed;
+			}
+			else out[i] = Timestamp{ 0ULL };
+		}
+		return parsed;
+	}
+
+	/// <summary>
+	/// <para>ģʽʱ䣬ģʽȱΪָУɷʹ</para>
+	/// <para>%Y  %y λ(2000) %m  %b Ӣ·д %d  %H ʱ %I 12Сʱʱ %p AM/PM</para>
+	/// <para>%M  %S  %f С %z ʱ(ZHH[:]MM) %% ٷֺţַԭƥ</para>
+	/// <para>ֶȡ(4λ2λ)1λ%Y%m%d2024/1/5ɽ</para>
+	/// </summary>
+	export template<details::time_char Char>
+	struct TimePattern {
+	private:
+		enum Kind : mqui8 { LITERAL, YEAR, YEAR2, MONTH, MONTH_NAME, DAY, HOUR, HOUR12, AMPM, MINUTE, SECOND, FRACTION, ZONE };
+
+		struct Op {
+			Kind kind;
+			Char c;
+		};
+
+		mqlist<Op> ops;
+		bool valid{ };
+
+		static bool _number(Char const* p, mqui64 size, mqui64& i, mqui32 width, mqui32& value) noexcept {
+			mqui64 j{ i };
+			mqui32 v{ };
+			for (; j < size && j - i < width && details::TimeDigit(p[j]); ++j) {
+				v = v * 10U + static_cast<mqui32>(p[j] - static_cast<Char>('0'));
+			}
+			if (j == i) return false;
+			i = j;
+			value = v;
+			return true;
+		}
+
+		static constexpr Char _lower(Char c) noexcept {
+			return c >= static_cast<Char>('A') && c <= static_cast<Char>('Z') ? static_cast<Char>(c + ('a' - 'A')) : c;
+		}
+
+		bool _parse(Char const* p, mqui64 size, details::TimeFields& f) const noexcept {
+			mqi64 year{ 1970LL }, fraction{ }, offset{ };
+			mqui32 month{ 1U }, day{ 1U }, hour{ }, minute{ }, second{ }, value{ };
+			bool pm{ }, hour12{ }, zoned{ };
+			mqui64 i{ };
+			for (auto& op : ops) {
+				switch (op.kind) {
+				case LITERAL:
+					if (i == size || p[i] != op.c) return false;
+					++i;
+					break;
+				case YEAR:
+					if (!_number(p, size, i, 4U, value)) return false;
+					year = value;
+					break;
+				case YEAR2:
+					if (!_number(p, size, i, 2U, value)) return false;
+					year = 2000LL + value;
+					break;
+				case MONTH:
+					if (!_number(p, size, i, 2U, month)) return false;
+					break;
+				case MONTH_NAME: {
+					constexpr char names[]{ "janfebmaraprmayjunjulaugsepoctnovdec" };
+					if (size - i < 3ULL) return false;
+					month = 0U;
+					for (mqui32 m{ }; m < 12U; ++m) {
+						if (_lower(p[i]) == names[m * 3U] && _lower(p[i + 1ULL]) == names[m * 3U + 1U] && _lower(p[i + 2ULL]) == names[m * 3U + 2U]) {
+							month = m + 1U;
+							break;
+						}
+					}
+					if (month == 0U) return false;
+					i += 3ULL;
+					break;
+				}
+				case DAY:
+					if (!_number(p, size, i, 2U, day)) return false;
+					break;
+				case HOUR:
+				case HOUR12:
+					if (!_number(p, size, i, 2U, hour)) return false;
+					hour12 = op.kind == HOUR12;
+					break;
+				case AMPM:
+					if (size - i < 2ULL || _lower(p[i + 1ULL]) != static_cast<Char>('m')) return false;
+					if (_lower(p[i]) == static_cast<Char>('p')) pm = true;
+					else if (_lower(p[i]) != static_cast<Char>('a')) return false;
+					i += 2ULL;
+					break;
+				case MINUTE:
+					if (!_number(p, size, i, 2U, minute)) return false;
+					break;
+				case SECOND:
+					if (!_number(p, size, i, 2U, second)) return false;
+					break;
+				case FRACTION:
+					if (!details::TimeParseFraction(p, size, i, fraction)) return false;
+					break;
+				case ZONE:
+					if (!details::TimeParseZone(p, size, i, offset)) return false;
+					zoned = true;
+					break;
+				}
+			}
+			if (hour12) {
+				if (hour < 1U || hour > 12U) return false;
+				hour = hour % 12U + (pm ? 12U : 0U);
+			}
+			if (i != size || hour > 23U || minute > 59U || second > 60U) return false;
+			if (month < 1U || month > 12U || day < 1U || day > details::TimeMonthDays(year, month)) return false;
+			f = { year, month, day, hour * 3600LL + minute * 60LL + second, fraction, offset, zoned };
+			return true;
+		}
+	public:
+		/// <summary>
+		/// ģʽ
+		/// </summary>
+		/// <param name="pattern">ģʽ%Y/%m/%d %H:%M:%S.%f</param>
+		explicit TimePattern(std::basic_string_view<Char> pattern) noexcept : ops(pattern.size()) {
+			for (mqui64 i{ }; i < pattern.size(); ++i) {
+				if (pattern[i] != static_cast<Char>('%')) {
+					ops.add(Op{ LITERAL, pattern[i] });
+					continue;
+				}
+				if (++i == pattern.size()) return;
+				Kind kind{ };
+				switch (pattern[i]) {
+				case static_cast<Char>('%'): ops.add(Op{ LITERAL, pattern[i] }); continue;
+				case static_cast<Char>('Y'): kind = YEAR; break;
+				case static_cast<Char>('y'): kind = YEAR2; break;
+				case static_cast<Char>('m'): kind = MONTH; break;
+				case static_cast<Char>('b'): kind = MONTH_NAME; break;
+				case static_cast<Char>('d'): kind = DAY; break;
+				case static_cast<Char>('H'): kind = HOUR; break;
+				case static_cast<Char>('I'): kind = HOUR12; break;
+				case static_cast<Char>('p'): kind = AMPM; break;
+				case static_cast<Char>('M'): kind = MINUTE; break;
+				case static_cast<Char>('S'): kind = SECOND; break;
+				case static_cast<Char>('f'): kind = FRACTION; break;
+				case static_cast<Char>('z'): kind = ZONE; break;
+				default: return;
+				}
+				ops.add(Op{ kind, Char{ } });
+			}
+			valid = true;
+		}
+
+		/// <summary>
+		/// ģʽǷϷ
+		/// </summary>
+		[[nodiscard]] operator bool() const noexcept {
+			return valid;
+		}
+
+		/// <summary>
+		/// ʱ䣬δֵֶȡ1970-01-01ʱֶȡ0
+		/// </summary>
+		/// <param name="str">ַ</param>
+		/// <param name="ts"></param>
+		/// <param name="zone">ģʽ%zʱõʱ</param>
+		/// <returns>Ƿɹʧʱts</returns>
+		[[nodiscard]] bool parse(std::basic_string_view<Char> str, Timestamp& ts, Timestamp::Zone zone = Timestamp::Zone::CN_BEIJING) const noexcept {
+			details::TimeFields f;
+			if (!valid || !_parse(str.data(), str.size(), f)) return false;
+			ts = details::TimeCombine(f, details::DaysFromCivil(f.year, f.month, f.day), zone);
+			return true;
+		}
+
+		/// <summary>
+		/// һʱ
+		/// </summary>
+		/// <param name="strs">ַ</param>
+		/// <param name="count"></param>
+		/// <param name="out">飬ʧܵλд0</param>
+		/// <param name="zone">ģʽ%zʱõʱ</param>
+		/// <returns>ɹĸ</returns>
+		mqui64 parse(std::basic_string_view<Char> const* strs, mqui64 count, Timestamp* out, Timestamp::Zone zone = Timestamp::Zone::CN_BEIJING) const noexcept {
+			details::TimeDayCache cache;
+			details::TimeFields f;
+			mqui64 parsed{ };
+			for (mqui64 i{ }; i < count; ++i) {
+				if (valid && _parse(strs[i].data(), strs[i].size(), f)) {
+					out[i] = details::TimeCombine(f, cache(f), zone);
+					++parsed;
+				}
+				else out[i] = Timestamp{ 0ULL };
+			}
+			return parsed;
+		}
+	};
+
+	/// <summary>
+	/// <para>ʱʽ棬ʽΪ2024-01-23 22:38:49.012</para>
+	/// <para>ʱͬһʱѸʽʱ룬ֻдС֣ʺ־ǰ׺</para>
+	/// </summary>
+	export template<details::time_char Char>
+	struct TimeFormatCache {
+		// 󳤶ȣβ0
+		static constexpr mqui64 FormatSize{ 27ULL };
+	private:
+		mqi64 cached{ -1LL }; // ѻı
+		Char prefix[19ULL]{ };
+	public:
+		/// <summary>
+		/// ʽ÷
+		/// </summary>
+		/// <param name="p">FormatSizeַ</param>
+		/// <param name="ts">ʱ</param>
+		/// <param name="digits">Сλ0367</param>
+		/// <param name="zone">ʱ</param>
+		/// <returns>дĩβ</returns>
+		Char* format(Char* p, Timestamp ts, mqui32 digits = 3U, Timestamp::Zone zone = Timestamp::Zone::CN_BEIJING) noexcept {
+			auto ticks{ static_cast<mqi64>(static_cast<mqui64>(ts) + zone) };
+			auto seconds{ details::FloorDiv(ticks, details::TicksPerSecond) };
+			if (seconds != cached) {
+				auto t{ ts.local(zone) };
+				Char str[Time::FormatSize];
+				t.formatTo(str);
+				freestanding::copy(prefix, str, sizeof(prefix));
+				cached = seconds;
+			}
+			freestanding::copy(p, prefix, sizeof(prefix));
+			p += 19ULL;
+			if (digits == 0U) return p;
+			if (digits > 7U) digits = 7U;
+			auto fraction{ static_cast<mqui32>(ticks - seconds * details::TicksPerSecond) };
+			*p++ = static_cast<Char>('.');
+			p = details::TimeDigits<7U>(p, fraction);
+			return p - (7U - digits);
+		}
+	};
+
+	/// <summary>
+	/// ǰ̵߳ʱʽ
+	/// </summary>
+	export template<details::time_char Char>
+	[[nodiscard]] inline TimeFormatCache<Char>& ThreadTimeFormatCache() noexcept {
+		thread_local TimeFormatCache<Char> cache;
+		return cache;
+	}
+
+	// ʱصΪʱarg
+	export using TimerCallBack = void(__stdcall*)(mqmem);
+
+	// ʱʶ0ΪЧ
+	export using TimerId = mqui64;
+
+	/// <summary>
+	/// <para>ֲʱ֣4256ۣ2^32̶ȣԶĶʱȷ߲㣬ǰ</para>
+	/// <para>ʱڵ±˫ӣȡΪO(1)ʶͷŵıʶȡЧ</para>
+	/// <para>MonotonicClockʱ100Ϊλ̰߳ȫɵ÷߳poll</para>
+	/// </summary>
+	export struct TimerWheel {
+		static constexpr mqui32 LevelBits{ 8U };
+		static constexpr mqui32 Slots{ 1U << LevelBits };
+		static constexpr mqui32 Levels{ 4U };
+	private:
+		static constexpr mqui32 Nil{ 0xFFFFFFFFU };
+		static constexpr mqui32 Pending{ Levels * Slots }; // ̶ȴ
+		static constexpr mqui32 Firing{ Pending + 1U }; // ִлص
+		static constexpr mqui32 Free{ Pending + 2U };
+
+		struct Node {
+			mqui64 expire; // ڿ̶
+			mqui64 period; // ڿ̶0Ϊ
+			TimerCallBack callback;
+			mqmem arg;
+			mqui32 prev;
+			mqui32 next;
+			mqui32 list; // 
+			mqui32 generation;
+		};
+
+		mqlist<Node> nodes;
+		mqui32 freeHead{ Nil };
+		mqui32 heads[Pending + 1U];
+		mqui64 occupied[Slots / 64U]{ }; // 0ǿղ۵λͼղ
+		mqui64 resolution;
+		mqui64 current{ }; // һĿ̶
+		mqui64 deadline{ }; // pollĿ̶
+		mqui64 count{ };
+
+		void _link(mqui32 i, mqui32 list) noexcept {
+			auto& node{ nodes[i] };
+			node.list = list;
+			node.prev = Nil;
+			node.next = heads[list];
+			if (node.next != Nil) nodes[node.next].prev = i;
+			heads[list] = i;
+			if (list < Slots) occupied[list / 64U] |= 1ULL << (list % 64U);
+		}
+
+		void _unlink(mqui32 i) noexcept {
+			auto& node{ nodes[i] };
+			if (node.prev != Nil) nodes[node.prev].next = node.next;
+			else heads[node.list] = node.next;
+			if (node.next != Nil) nodes[node.next].prev = node.prev;
+			if (node.list < Slots && heads[node.list] == Nil) occupied[node.list / 64U] &= ~(1ULL << (node.list % 64U));
+		}
+
+		// 뵱ǰ̶ȵľѡ㣬С256^(L+1)ڵL
+		void _place(mqui32 i) noexcept {
+			auto expire{ nodes[i].expire < current ? current : nodes[i].expire };
+			auto delta{ expire - current };
+			mqui32 level{ };
+			while (level < Levels - 1U && delta >= (1ULL << (LevelBits * (level + 1U)))) ++level;
+			if (delta >= (1ULL << (LevelBits * Levels))) expire = current + (1ULL << (LevelBits * Levels)) - 1ULL;
+			_link(i, level * Slots + static_cast<mqui32>((expire >> (LevelBits * level)) & (Slots - 1U)));
+		}
+
+		// ̶tΪ߽ʱӸߵͰѶӦеĶʱ·
+		void _cascade(mqui64 t) noexcept {
+			for (mqui32 level{ Levels - 1U }; level > 0U; --level) {
+				if ((t & ((1ULL << (LevelBits * level)) - 1ULL)) != 0ULL) continue;
+				auto list{ level * Slots + static_cast<mqui32>((t >> (LevelBits * level)) & (Slots - 1U)) };
+				auto i{ heads[list] };
+				heads[list] = Nil;
+				while (i != Nil) {
+					auto next{ nodes[i].next };
+					_place(i);
+					i = next;
+				}
+			}
+		}
+
+		// 0slotһǿղۣ򷵻Slots
+		[[nodiscard]] mqui32 _scan(mqui32 slot) const noexcept {
+			for (mqui32 word{ slot / 64U }; word < Slots / 64U; ++word) {
+				auto bits{ occupied[word] };
+				if (word == slot / 64U) bits &= ~0ULL << (slot % 64U);
+				if (bits) {
+					unsigned long index;
+					_BitScanForward64(&index, bits);
+					return word * 64U + static_cast<mqui32>(index);
+				}
+			}
+			return Slots;
+		}
+
+		void _free(mqui32 i) noexcept {
+			auto& node{ nodes[i] };
+			node.list = Free;
+			node.next = freeHead;
+			++node.generation;
+			freeHead = i;
+			--count;
+		}
+
+		// 0һۣǰcurrentԽÿ̶ȣصӵĶʱ뱾
+		mqui64 _fire(mqui32 slot) noexcept {
+			heads[Pending] = heads[slot];
+			heads[slot] = Nil;
+			occupied[slot / 64U] &= ~(1ULL << (slot % 64U));
+			for (auto i{ heads[Pending] }; i != Nil; i = nodes[i].next) nodes[i].list = Pending;
+			mqui64 fired{ };
+			while (heads[Pending] != Nil) {
+				auto i{ heads[Pending] };
+				_unlink(i);
+				nodes[i].list = Firing;
+				auto callback{ nodes[i].callback };
+				auto arg{ nodes[i].arg };
+				callback(arg); // صпӻȡʱnodesݣ֮ȡ±
+				++fired;
+				auto& node{ nodes[i] };
+				if (node.list != Firing) continue;
+				if (node.period) {
+					node.expire += node.period;
+					if (node.expire <= deadline) { // ڲڶ뵽poll֮
+						node.expire += ((deadline - node.expire) / node.period + 1ULL) * node.period;
+					}
+					_place(i);
+				}
+				else _free(i);
+			}
+			return fired;
+		}
+	public:
+		/// <summary>
+		/// ʱ
+		/// </summary>
+		/// <param name="resolution">̶ȣλΪ100룬Ĭ1</param>
+		explicit TimerWheel(mqui64 resolution = 10000ULL) noexcept : resolution{ resolution ? resolution : 1ULL } {
+			for (auto& head : heads) head = Nil;
+			current = MonotonicClock::now() / this->resolution;
+		}
+
+		TimerWheel(TimerWheel const&) = delete;
+		TimerWheel& operator = (TimerWheel const&) = delete;
+
+		/// <summary>
+		/// Ӷʱ
+		/// </summary>
+		/// <param name="delay">ӳ٣λΪ100룬ȡ̶</param>
+		/// <param name="callback">ص</param>
+		/// <param name="arg">ص</param>
+		/// <param name="period">ڣλΪ100룬0Ϊ</param>
+		/// <returns>ʱʶ</returns>
+		TimerId add(mqui64 delay, TimerCallBack callback, mqmem arg = nullptr, mqui64 period = 0ULL) noexcept {
+			mqui32 i;
+			if (freeHead != Nil) {
+				i = freeHead;
+				freeHead = nodes[i].next;
+			}
+			else {
+				i = static_cast<mqui32>(nodes.size());
+				nodes.add(Node{ });
+			}
+			auto& node{ nodes[i] };
+			node.expire = MonotonicClock::now() / resolution + (delay + resolution - 1ULL) / resolution;
+			node.period = period ? (period + resolution - 1ULL) / resolution : 0ULL;
+			node.callback = callback;
+			node.arg = arg;
+			_place(i);
+			++count;
+			return (static_cast<mqui64>(node.generation) << 32ULL) | (i + 1ULL);
+		}
+
+		/// <summary>
+		/// ȡʱڻصȡʱ
+		/// </summary>
+		/// <param name="id">ʱʶ</param>
+		/// <returns>ʱǷ</returns>
+		bool cancel(TimerId id) noexcept {
+			auto i{ static_cast<mqui32>(id & 0xFFFFFFFFULL) - 1U };
+			if (i >= nodes.size() || nodes[i].generation != static_cast<mqui32>(id >> 32ULL) || nodes[i].list == Free) return false;
+			if (nodes[i].list != Firing) _unlink(i); // ִлصĽڵѲ
+			_free(i);
+			return true;
+		}
+
+		/// <summary>
+		/// nowΪֹڵĶʱ
+		/// </summary>
+		/// <param name="now">MonotonicClock::now()ʱ</param>
+		/// <returns>ĸ</returns>
+		mqui64 poll(mqui64 now) noexcept {
+			auto target{ now / resolution };
+			deadline = target;
+			mqui64 fired{ };
+			while (current <= target) {
+				auto t{ current };
+				auto slot{ static_cast<mqui32>(t & (Slots - 1U)) };
+				if (slot == 0U) _cascade(t);
+				auto next{ _scan(slot) };
+				auto base{ t - slot };
+				if (next == Slots || base + next > target) { // ʣĲΪջδ
+					auto end{ base + Slots - 1ULL };
+					current = (end < target ? end : target) + 1ULL;
+					continue;
+				}
+				current = base + next + 1ULL;
+				fired += _fire(next);
+			}
+			return fired;
+		}
+
+		/// <summary>
+		/// ǰڵĶʱ
+		/// </summary>
+		mqui64 poll() noexcept {
+			return poll(MonotonicClock::now());
+		}
+
+		/// <summary>
+		/// ´Ҫpollʱ䣬λΪ100룬ʵʵڣ޶ʱʱֵ
+		/// </summary>
+		[[nodiscard]] mqui64 wait() const noexcept {
+			if (count == 0ULL) return ~0ULL;
+			auto slot{ static_cast<mqui32>(current & (Slots - 1U)) };
+			auto tick{ current }; // λڱ߽ʱƸ߲
+			if (slot != 0U) tick = current - slot + _scan(slot); // ޶ʱʱΪһ߽
+			auto when{ tick * resolution }, now{ MonotonicClock::now() };
+			return when > now ? when - now : 0ULL;
+		}
+
+		/// <summary>
+		/// ʱ
+		/// </summary>
+		[[nodiscard]] mqui64 size() const noexcept {
+			return count;
+		}
+	};
+
+	/// <summary>
+	/// <para>ں̨߳ʱ֣ɴ߳ȡʱ</para>
+	/// <para>صںִ̨߳Уִڼصпȡʱ</para>
+	/// </summary>
+	export struct TimerScheduler {
+	private:
+		TimerWheel wheel;
+		std::recursive_mutex mutex;
+		std::condition_variable_any cv;
+		std::thread thread;
+		mqui64 epoch{ }; // ÿ½̼߳һֵ̼߳ͬ˳
+		bool running{ };
+
+		void _run(mqui64 current) noexcept {
+			std::unique_lock<std::recursive_mutex> lock{ mutex };
+			while (running && epoch == current) {
+				wheel.poll();
+				auto wait{ wheel.wait() };
+				if (!running || epoch != current) break;
+				if (wait == ~0ULL) cv.wait(lock);
+				else if (wait) cv.wait_for(lock, std::chrono::nanoseconds{ wait * 100ULL });
+			}
+		}
+	public:
+		/// <summary>
+		/// start̨߳
+		/// </summary>
+		/// <param name="resolution">̶ȣλΪ100룬Ĭ1</param>
+		explicit TimerScheduler(mqui64 resolution = 10000ULL) noexcept : wheel{ resolution } { }
+
+		TimerScheduler(TimerScheduler const&) = delete;
+		TimerScheduler& operator = (TimerScheduler const&) = delete;
+
+		~TimerScheduler() noexcept {
+			stop();
+		}
+
+		/// <summary>
+		/// ̨߳
+		/// </summary>
+		/// <returns>Ƿʱfalse</returns>
+		bool start() noexcept {
+			std::thread old;
+			{
+				std::lock_guard<std::recursive_mutex> lock{ mutex };
+				if (running) return false;
+				running = true;
+				// صstopstartǰ̼߳
+				if (thread.joinable() && thread.get_id() == std::this_thread::get_id()) return true;
+				// صstopδյ߳ȴ˳
+				old = freestanding::move(thread);
+				thread = std::thread{ &TimerScheduler::_run, this, ++epoch };
+			}
+			cv.notify_all();
+			if (old.joinable()) old.join();
+			return true;
+		}
+
+		/// <summary>
+		/// ֹ̨̣ͣ߳δڵĶʱڻصеʱ֪ͨ߳˳֮߳startstop
+		/// </summary>
+		void stop() noexcept {
+			std::thread old;
+			{
+				std::lock_guard<std::recursive_mutex> lock{ mutex };
+				running = false;
+				if (thread.joinable() && thread.get_id() != std::this_thread::get_id()) old = freestanding::move(thread);
+			}
+			cv.notify_all();
+			if (old.joinable()) old.join();
+		}
+
+		/// <summary>
+		/// ӶʱͬTimerWheel::add
+		/// </summary>
+		TimerId add(mqui64 delay, TimerCallBack callback, mqmem arg = nullptr, mqui64 period = 0ULL) noexcept {
+			TimerId id;
+			{
+				std::lock_guard<std::recursive_mutex> lock{ mutex };
+				id = wheel.add(delay, callback, arg, period);
+			}
+			cv.notify_one();
+			return id;
+		}
+
+		/// <summary>
+		/// ȡʱ
+		/// </summary>
+		bool cancel(TimerId id) noexcept {
+			std::lock_guard<std::recursive_mutex> lock{ mutex };
+			return wheel.cancel(id);
+		}
+
+		/// <summary>
+		/// ʱ
+		/// </summary>
+		[[nodiscard]] mqui64 size() noexcept {
+			std::lock_guard<std::recursive_mutex> lock{ mutex };
+			return wheel.size();
+		}
+	};
+}
+
 export [[nodiscard]] inline constexpr MasterQian::Timestamp operator ""_timestamp(mqui64 value) noexcept {
 	return MasterQian::Timestamp{ value };
 }
 
-export [[nodiscard]] inline MasterQian::Time operator ""_time(mqui64 value) noexcept {
+export [[nodiscard]] inline constexpr MasterQian::Time operator ""_time(mqui64 value) noexcept {
 	return MasterQian::Timestamp{ value }.local();
 }
\ No newline at end of file
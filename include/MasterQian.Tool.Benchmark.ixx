@@ -1,35 +1,795 @@
 module;
 #include "MasterQian.Meta.h"
 #include <string>
-#define MasterQianModuleName(name) MasterQian_Tool_Benchmark_##name
-#define MasterQianModuleNameString(name) "MasterQian_Tool_Benchmark_"#name
-#ifdef _DEBUG
-#define MasterQianLibString "MasterQian.Tool.Benchmark.Debug.dll"
-#else
-#define MasterQianLibString "MasterQian.Tool.Benchmark.dll"
-#endif
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <intrin.h>
 #define MasterQianModuleVersion 20240131ULL
-#pragma message(" Please copy [" MasterQianLibString "] into your program folder ")
 
 export module MasterQian.Tool.Benchmark;
-export import MasterQian.freestanding;
+export import MasterQian.Bin;
+export import MasterQian.Time;
+
+namespace MasterQian::api {
+	META_WINAPI(mqhandle, GetStdHandle, mqui32);
+	META_WINAPI(mqbool, CloseHandle, mqhandle);
+	META_WINAPI(mqhandle, CreateFileW, mqcstr, mqui32, mqui32, mqhandle, mqui32, mqui32, mqhandle);
+	META_WINAPI(mqbool, WriteFile, mqhandle, mqcmem, mqui32, mqui32*, mqhandle);
+	META_WINAPI(mqbool, ReadFile, mqhandle, mqmem, mqui32, mqui32*, mqhandle);
+	META_WINAPI(mqbool, GetFileSizeEx, mqhandle, mqi64*);
+	META_WINAPI(mqhandle, GetCurrentThread);
+	META_WINAPI(mqbool, QueryThreadCycleTime, mqhandle, mqui64*);
+}
+
+#pragma comment(linker,"/alternatename:__imp_?GetStdHandle@api@MasterQian@@YAPEAXI@Z::<!MasterQian.Tool.Benchmark>=__imp_GetStdHandle")
+#pragma comment(linker,"/alternatename:__imp_?CloseHandle@api@MasterQian@@YAHPEAX@Z::<!MasterQian.Tool.Benchmark>=__imp_CloseHandle")
+#pragma comment(linker,"/alternatename:__imp_?CreateFileW@api@MasterQian@@YAPEAXPEB_WIIPEAXII1@Z::<!MasterQian.Tool.Benchmark>=__imp_CreateFileW")
+#pragma comment(linker,"/alternatename:__imp_?WriteFile@api@MasterQian@@YAHPEAXPEBXIPEAI0@Z::<!MasterQian.Tool.Benchmark>=__imp_WriteFile")
+#pragma comment(linker,"/alternatename:__imp_?ReadFile@api@MasterQian@@YAHPEAX0IPEAI0@Z::<!MasterQian.Tool.Benchmark>=__imp_ReadFile")
+#pragma comment(linker,"/alternatename:__imp_?GetFileSizeEx@api@MasterQian@@YAHPEAXPEA_J@Z::<!MasterQian.Tool.Benchmark>=__imp_GetFileSizeEx")
+#pragma comment(linker,"/alternatename:__imp_?GetCurrentThread@api@MasterQian@@YAPEAXXZ::<!MasterQian.Tool.Benchmark>=__imp_GetCurrentThread")
+#pragma comment(linker,"/alternatename:__imp_?QueryThreadCycleTime@api@MasterQian@@YAHPEAXPEA_K@Z::<!MasterQian.Tool.Benchmark>=__imp_QueryThreadCycleTime")
 
 namespace MasterQian::Tool {
 	namespace details {
-		META_IMPORT_API(void, BenchmarkInitialize);
-		META_IMPORT_API(void, BenchmarkRun);
-		META_IMPORT_API(void, BenchmarkShutdown);
-		META_IMPORT_API(void, BenchmarkAdd, mqcmem, mqcmem, mqui64, mqui64, mqui64, mqcstr);
-		META_MODULE_BEGIN
-			META_PROC_API(BenchmarkInitialize);
-			META_PROC_API(BenchmarkRun);
-			META_PROC_API(BenchmarkShutdown);
-			META_PROC_API(BenchmarkAdd);
-		META_MODULE_END
+#ifdef _MSC_VER
+		inline void const volatile* BenchmarkSink;
+#endif
+
+		// ˫95%tֲٽֵ±Ϊɶȣʱȡ̬
+		constexpr double StudentT95[]{ 0.0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+			2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+			2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+
+		// μʱĵ
+		constexpr mqui64 BenchmarkMaxIterations{ 1000000000ULL };
+
+		// Ͳctxdestroyͷ
+		struct BenchmarkCase {
+			std::wstring name;
+			mqmem ctx;
+			void(*run)(mqmem, mqui64) noexcept;
+			void(*setup)(mqmem) noexcept;
+			void(*teardown)(mqmem) noexcept;
+			void(*destroy)(mqmem) noexcept;
+			mqui64 iterations; // 0ʾԶУ׼
+		};
+
+		template<typename Func>
+		void BenchmarkRunCallable(mqmem ctx, mqui64 n) noexcept {
+			auto& func{ *static_cast<Func*>(ctx) };
+			for (mqui64 i{ }; i < n; ++i) {
+				func();
+			}
+		}
+
+		template<typename Fixture>
+		void BenchmarkRunFixture(mqmem ctx, mqui64 n) noexcept {
+			auto& fixture{ *static_cast<Fixture*>(ctx) };
+			for (mqui64 i{ }; i < n; ++i) {
+				fixture.run();
+			}
+		}
+
+		template<typename T>
+		void BenchmarkDestroy(mqmem ctx) noexcept {
+			delete static_cast<T*>(ctx);
+		}
+
+		// Ժʵĵλʽ
+		inline std::string BenchmarkTime(double ns) noexcept {
+			char buf[32]{ };
+			if (ns < 1e3) std::snprintf(buf, sizeof(buf), "%.2f ns", ns);
+			else if (ns < 1e6) std::snprintf(buf, sizeof(buf), "%.2f us", ns / 1e3);
+			else if (ns < 1e9) std::snprintf(buf, sizeof(buf), "%.2f ms", ns / 1e6);
+			else std::snprintf(buf, sizeof(buf), "%.2f s", ns / 1e9);
+			return buf;
+		}
+	}
+
+	/// <summary>
+	/// ֹvalueļŻvalueΪѶȡҿܱ޸
+	/// </summary>
+	/// <param name="value">Ҫֵ</param>
+	export template<typename T>
+	inline void DoNotOptimize(T const& value) noexcept {
+#ifdef _MSC_VER
+		details::BenchmarkSink = &value;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	export template<typename T>
+	inline void DoNotOptimize(T& value) noexcept {
+#ifdef _MSC_VER
+		details::BenchmarkSink = &value;
+		_ReadWriteBarrier();
+#else
+		if constexpr (freestanding::trivial<T> && sizeof(T) <= sizeof(T*)) {
+			asm volatile("" : "+m,r"(value) : : "memory");
+		}
+		else {
+			asm volatile("" : "+m"(value) : : "memory");
+		}
+#endif
+	}
+
+	/// <summary>
+	/// ڴϣ֮ǰд벻ᱻƵ֮
+	/// </summary>
+	export inline void ClobberMemory() noexcept {
+#ifdef _MSC_VER
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+
+	// Ӳ
+	export enum class BenchmarkCounter : mqenum {
+		THREAD_TSC_CYCLES, // ߳ڣQueryThreadCycleTimeTSCƵۼƣں̬ʱ䣬Ǻʵ
+		INSTRUCTIONS, // ָ
+		CACHE_MISSES, // ĩδ
+		BRANCH_MISSES, // ֧Ԥʧ
+	};
+
+	namespace details {
+		constexpr mqui64 BenchmarkCounterCount{ 4ULL };
+		constexpr std::string_view BenchmarkCounterName[]{ "thread_tsc_cycles", "instructions", "cache_misses", "branch_misses" };
+		constexpr std::string_view BenchmarkCounterNote{ "QueryThreadCycleTime at TSC rate, includes kernel time" };
+
+		// Ӧ±꣬ݾɰ汾cyclesδ֪ʱBenchmarkCounterCount
+		inline mqui64 BenchmarkCounterIndex(std::string_view name) noexcept {
+			if (name == "cycles") return static_cast<mqenum>(BenchmarkCounter::THREAD_TSC_CYCLES);
+			return static_cast<mqui64>(std::find(std::begin(BenchmarkCounterName), std::end(BenchmarkCounterName), name) - std::begin(BenchmarkCounterName));
+		}
+
+		/// <summary>
+		/// <para>ȡǰ̵߳Ӳؿüλ</para>
+		/// <para>Windowsûֻ̬ṩQueryThreadCycleTimeTSCƵۼ߳û̬ں̬</para>
+		/// <para>˼ΪTHREAD_TSC_CYCLESǺڣƵʱ仯ں̬ʱ䶼</para>
+		/// <para>ָδҪںԱȨ޵ETWỰﱨΪãipcҲ֮</para>
+		/// </summary>
+		inline mqui32 BenchmarkCounterRead(mqui64 (&values)[BenchmarkCounterCount]) noexcept {
+			mqui32 mask{ };
+			if (api::QueryThreadCycleTime(api::GetCurrentThread(), &values[static_cast<mqenum>(BenchmarkCounter::THREAD_TSC_CYCLES)])) {
+				mask |= 1U << static_cast<mqenum>(BenchmarkCounter::THREAD_TSC_CYCLES);
+			}
+			return mask;
+		}
+	}
+
+	// һĲʱΪε
+	export struct BenchmarkResult {
+		std::wstring name;
+		mqui64 iterations{ }; // ÿظĵ
+		mqlist<double> samples; // ÿظõĵεʱ
+		double mean{ };
+		double median{ };
+		double stddev{ }; // ׼
+		double min{ };
+		double max{ };
+		double ci{ }; // ֵ95%İ
+		mqui32 counterMask{ }; // õӲiλӦBenchmarkCounterĵi
+		double counters[details::BenchmarkCounterCount]{ }; // ÿεӲֵ
+
+		/// <summary>
+		/// Ƿ
+		/// </summary>
+		[[nodiscard]] bool has(BenchmarkCounter counter) const noexcept {
+			return (counterMask >> static_cast<mqenum>(counter)) & 1U;
+		}
+
+		/// <summary>
+		/// ÿεļֵʱΪ0
+		/// </summary>
+		[[nodiscard]] double counter(BenchmarkCounter counter) const noexcept {
+			return has(counter) ? counters[static_cast<mqenum>(counter)] : 0.0;
+		}
+
+		/// <summary>
+		/// ÿTSCָָʱΪ0ʱָãԴĽʱֵ
+		/// </summary>
+		[[nodiscard]] double ipc() const noexcept {
+			auto cycles{ counter(BenchmarkCounter::THREAD_TSC_CYCLES) };
+			return has(BenchmarkCounter::INSTRUCTIONS) && cycles > 0.0 ? counter(BenchmarkCounter::INSTRUCTIONS) / cycles : 0.0;
+		}
+
+		/// <summary>
+		/// samplesͳ
+		/// </summary>
+		void statistics() noexcept {
+			auto n{ samples.size() };
+			if (n == 0ULL) return;
+			mqlist<double> sorted{ samples };
+			std::sort(sorted.begin(), sorted.end());
+			min = sorted.front();
+			max = sorted.back();
+			median = (n & 1ULL) ? sorted[n / 2ULL] : (sorted[n / 2ULL - 1ULL] + sorted[n / 2ULL]) / 2.0;
+			double sum{ };
+			for (auto v : sorted) sum += v;
+			mean = sum / static_cast<double>(n);
+			if (n > 1ULL) {
+				double var{ };
+				for (auto v : sorted) var += (v - mean) * (v - mean);
+				stddev = std::sqrt(var / static_cast<double>(n - 1ULL));
+				auto t{ n - 1ULL < std::size(details::StudentT95) ? details::StudentT95[n - 1ULL] : 1.96 };
+				ci = t * stddev / std::sqrt(static_cast<double>(n));
+			}
+			else {
+				stddev = ci = 0.0;
+			}
+		}
+	};
+
+	// ʽ
+	export enum class BenchmarkFormat : mqenum {
+		CONSOLE, // ı
+		JSON, // ÿظBenchmarkLoad
+		CSV, // ÿһУԿոָһУBenchmarkLoad
+	};
+
+	namespace details {
+		inline void BenchmarkNumber(std::string& buf, double v) noexcept {
+			char tmp[32]{ };
+			std::snprintf(tmp, sizeof(tmp), "%.9g", v);
+			buf += tmp;
+		}
+
+		inline void BenchmarkJsonString(std::string& buf, std::wstring_view sv) noexcept {
+			auto bin{ ToBin(sv) };
+			buf.push_back('"');
+			for (mqui64 i{ }; i < bin.size(); ++i) {
+				auto c{ static_cast<mqchara>(bin.data()[i]) };
+				if (c == '"' || c == '\\') {
+					buf.push_back('\\');
+					buf.push_back(c);
+				}
+				else if (static_cast<mqbyte>(c) < 0x20U) {
+					char tmp[8]{ };
+					std::snprintf(tmp, sizeof(tmp), "\\u%04x", static_cast<unsigned>(c));
+					buf += tmp;
+				}
+				else {
+					buf.push_back(c);
+				}
+			}
+			buf.push_back('"');
+		}
+
+		inline void BenchmarkCsvString(std::string& buf, std::wstring_view sv) noexcept {
+			auto bin{ ToBin(sv) };
+			std::string_view s{ reinterpret_cast<mqcstra>(bin.data()), bin.size() };
+			if (s.find_first_of(",\"\r\n") == std::string_view::npos) {
+				buf += s;
+				return;
+			}
+			buf.push_back('"');
+			for (auto c : s) {
+				if (c == '"') buf.push_back('"');
+				buf.push_back(c);
+			}
+			buf.push_back('"');
+		}
+
+		// УʱΪ-
+		inline void BenchmarkCounterColumn(std::string& buf, bool available, double v, char const* format) noexcept {
+			char tmp[32]{ };
+			if (available) std::snprintf(tmp, sizeof(tmp), format, v);
+			else std::snprintf(tmp, sizeof(tmp), " %12s", "-");
+			buf += tmp;
+		}
+
+		inline std::string BenchmarkConsole(mqlist<BenchmarkResult> const& results) noexcept {
+			// ֻʾһõļУʱֻͨTscCycles
+			mqui32 mask{ };
+			bool ipc{ };
+			for (auto& r : results) {
+				mask |= r.counterMask;
+				ipc = ipc || r.ipc() > 0.0;
+			}
+			constexpr char const* titles[]{ "TscCycles", "Instructions", "CacheMiss", "BranchMiss" };
+			constexpr char const* formats[]{ " %12.1f", " %12.1f", " %12.3f", " %12.3f" };
+			char line[256]{ };
+			std::string buf;
+			std::snprintf(line, sizeof(line), "%-40s %12s %12s %12s %12s %12s",
+				"Benchmark", "Iterations", "Mean", "Median", "StdDev", "95% CI");
+			buf += line;
+			mqui64 width{ 105ULL };
+			for (mqui64 k{ }; k < BenchmarkCounterCount; ++k) {
+				if (!((mask >> k) & 1U)) continue;
+				std::snprintf(line, sizeof(line), " %12s", titles[k]);
+				buf += line;
+				width += 13ULL;
+				if (k == static_cast<mqenum>(BenchmarkCounter::INSTRUCTIONS) && ipc) {
+					std::snprintf(line, sizeof(line), " %12s", "IPC");
+					buf += line;
+					width += 13ULL;
+				}
+			}
+			buf += '\n';
+			buf.append(width, '-');
+			buf += '\n';
+			for (auto& r : results) {
+				auto name{ ToBin(r.name) };
+				std::snprintf(line, sizeof(line), "%-40.*s %12llu %12s %12s %12s %12s",
+					static_cast<int>(name.size()), reinterpret_cast<mqcstra>(name.data()),
+					static_cast<unsigned long long>(r.iterations), BenchmarkTime(r.mean).c_str(),
+					BenchmarkTime(r.median).c_str(), BenchmarkTime(r.stddev).c_str(),
+					("+-" + BenchmarkTime(r.ci)).c_str());
+				buf += line;
+				for (mqui64 k{ }; k < BenchmarkCounterCount; ++k) {
+					if (!((mask >> k) & 1U)) continue;
+					BenchmarkCounterColumn(buf, (r.counterMask >> k) & 1U, r.counters[k], formats[k]);
+					if (k == static_cast<mqenum>(BenchmarkCounter::INSTRUCTIONS) && ipc) {
+						BenchmarkCounterColumn(buf, r.ipc() > 0.0, r.ipc(), " %12.2f");
+					}
+				}
+				buf += '\n';
+			}
+			if ((mask >> static_cast<mqenum>(BenchmarkCounter::THREAD_TSC_CYCLES)) & 1U) {
+				buf += "TscCycles: ";
+				buf += BenchmarkCounterNote;
+				buf += '\n';
+			}
+			return buf;
+		}
+
+		inline std::string BenchmarkJson(mqlist<BenchmarkResult> const& results) noexcept {
+			std::string buf{ "{\n  \"context\": {\"clock\": \"" };
+			buf += MonotonicClock::tsc() ? "tsc" : "qpc";
+			buf += "\", \"frequency\": ";
+			buf += std::to_string(MonotonicClock::frequency());
+			buf += ", \"thread_tsc_cycles\": \"";
+			buf += BenchmarkCounterNote;
+			buf += "\"},\n  \"benchmarks\": [";
+			for (mqui64 i{ }; i < results.size(); ++i) {
+				auto& r{ results[i] };
+				buf += i ? ",\n    {\"name\": " : "\n    {\"name\": ";
+				BenchmarkJsonString(buf, r.name);
+				buf += ", \"iterations\": ";
+				buf += std::to_string(r.iterations);
+				buf += ", \"repetitions\": ";
+				buf += std::to_string(r.samples.size());
+				constexpr std::string_view keys[]{ ", \"mean_ns\": ", ", \"median_ns\": ", ", \"stddev_ns\": ",
+					", \"min_ns\": ", ", \"max_ns\": ", ", \"ci95_ns\": " };
+				double const values[]{ r.mean, r.median, r.stddev, r.min, r.max, r.ci };
+				for (mqui64 k{ }; k < std::size(keys); ++k) {
+					buf += keys[k];
+					BenchmarkNumber(buf, values[k]);
+				}
+				for (mqui64 k{ }; k < BenchmarkCounterCount; ++k) {
+					buf += ", \"";
+					buf += BenchmarkCounterName[k];
+					buf += "\": ";
+					if ((r.counterMask >> k) & 1U) BenchmarkNumber(buf, r.counters[k]);
+					else buf += "null";
+				}
+				buf += ", \"ipc\": ";
+				if (r.ipc() > 0.0) BenchmarkNumber(buf, r.ipc());
+				else buf += "null";
+				buf += ", \"samples_ns\": [";
+				for (mqui64 k{ }; k < r.samples.size(); ++k) {
+					if (k) buf += ", ";
+					BenchmarkNumber(buf, r.samples[k]);
+				}
+				buf += "]}";
+			}
+			buf += "\n  ]\n}\n";
+			return buf;
+		}
+
+		inline std::string BenchmarkCsv(mqlist<BenchmarkResult> const& results) noexcept {
+			std::string buf{ "name,iterations,repetitions,mean_ns,median_ns,stddev_ns,min_ns,max_ns,ci95_ns,"
+				"thread_tsc_cycles,instructions,cache_misses,branch_misses,ipc,samples_ns\n" };
+			for (auto& r : results) {
+				BenchmarkCsvString(buf, r.name);
+				buf += ',';
+				buf += std::to_string(r.iterations);
+				buf += ',';
+				buf += std::to_string(r.samples.size());
+				for (auto v : { r.mean, r.median, r.stddev, r.min, r.max, r.ci }) {
+					buf += ',';
+					BenchmarkNumber(buf, v);
+				}
+				for (mqui64 k{ }; k < BenchmarkCounterCount; ++k) {
+					buf += ',';
+					if ((r.counterMask >> k) & 1U) BenchmarkNumber(buf, r.counters[k]);
+				}
+				buf += ',';
+				if (r.ipc() > 0.0) BenchmarkNumber(buf, r.ipc());
+				buf += ',';
+				for (mqui64 k{ }; k < r.samples.size(); ++k) {
+					if (k) buf += ' ';
+					BenchmarkNumber(buf, r.samples[k]);
+				}
+				buf += '\n';
+			}
+			return buf;
+		}
+
+		// ȡBenchmarkJsonдĵδֶ֪ͳ¼
+		struct BenchmarkJsonReader {
+			std::string_view s;
+			mqui64 i{ };
+
+			void ws() noexcept {
+				while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\n')) ++i;
+			}
+
+			bool eat(char c) noexcept {
+				ws();
+				if (i < s.size() && s[i] == c) {
+					++i;
+					return true;
+				}
+				return false;
+			}
+
+			bool string(std::string& out) noexcept {
+				if (!eat('"')) return false;
+				out.clear();
+				while (i < s.size() && s[i] != '"') {
+					if (s[i] == '\\') {
+						if (++i >= s.size()) return false;
+						switch (s[i]) {
+						case 'u': {
+							if (i + 4ULL >= s.size()) return false;
+							unsigned cp{ };
+							for (mqui64 k{ 1ULL }; k <= 4ULL; ++k) {
+								auto h{ s[i + k] };
+								cp = (cp << 4U) | static_cast<unsigned>(h <= '9' ? h - '0' : (h | 0x20) - 'a' + 10);
+							}
+							out.push_back(static_cast<char>(cp)); // ַ\uת
+							i += 4ULL;
+							break;
+						}
+						case 'n': out.push_back('\n'); break;
+						case 't': out.push_back('\t'); break;
+						case 'r': out.push_back('\r'); break;
+						default: out.push_back(s[i]); break;
+						}
+						++i;
+					}
+					else {
+						out.push_back(s[i++]);
+					}
+				}
+				return eat('"');
+			}
+
+			bool number(double& out) noexcept {
+				ws();
+				char* end{ };
+				std::string tmp{ s.substr(i, 64ULL) };
+				out = std::strtod(tmp.c_str(), &end);
+				if (end == tmp.c_str()) return false;
+				i += static_cast<mqui64>(end - tmp.c_str());
+				return true;
+			}
+
+			bool skip() noexcept {
+				ws();
+				if (i >= s.size()) return false;
+				if (s[i] == '"') {
+					std::string tmp;
+					return string(tmp);
+				}
+				if (s[i] == '{' || s[i] == '[') {
+					auto close{ s[i] == '{' ? '}' : ']' };
+					bool object{ s[i] == '{' };
+					++i;
+					if (eat(close)) return true;
+					do {
+						if (object) {
+							std::string key;
+							if (!string(key) || !eat(':')) return false;
+						}
+						if (!skip()) return false;
+					} while (eat(','));
+					return eat(close);
+				}
+				while (i < s.size() && s[i] != ',' && s[i] != '}' && s[i] != ']') ++i;
+				return true;
+			}
+
+			bool result(BenchmarkResult& r) noexcept {
+				if (!eat('{')) return false;
+				if (eat('}')) return true;
+				do {
+					std::string key;
+					if (!string(key) || !eat(':')) return false;
+					if (key == "name") {
+						std::string name;
+						if (!string(name)) return false;
+						r.name = ToString(BinView{ reinterpret_cast<mqcbytes>(name.data()), name.size() });
+					}
+					else if (key == "iterations") {
+						double v{ };
+						if (!number(v)) return false;
+						r.iterations = static_cast<mqui64>(v);
+					}
+					else if (auto k{ BenchmarkCounterIndex(key) }; k < BenchmarkCounterCount) {
+						ws();
+						if (s.substr(i, 4ULL) == "null") {
+							i += 4ULL;
+						}
+						else {
+							if (!number(r.counters[k])) return false;
+							r.counterMask |= 1U << k;
+						}
+					}
+					else if (key == "samples_ns") {
+						if (!eat('[')) return false;
+						if (!eat(']')) {
+							do {
+								double v{ };
+								if (!number(v)) return false;
+								r.samples.add(v);
+							} while (eat(','));
+							if (!eat(']')) return false;
+						}
+					}
+					else if (!skip()) {
+						return false;
+					}
+				} while (eat(','));
+				return eat('}');
+			}
+
+			bool document(mqlist<BenchmarkResult>& results) noexcept {
+				if (!eat('{')) return false;
+				if (eat('}')) return true;
+				do {
+					std::string key;
+					if (!string(key) || !eat(':')) return false;
+					if (key == "benchmarks") {
+						if (!eat('[')) return false;
+						if (!eat(']')) {
+							do {
+								BenchmarkResult r;
+								if (!result(r)) return false;
+								r.statistics();
+								results.add(freestanding::move(r));
+							} while (eat(','));
+							if (!eat(']')) return false;
+						}
+					}
+					else if (!skip()) {
+						return false;
+					}
+				} while (eat(','));
+				return eat('}');
+			}
+		};
+
+		// ȡBenchmarkCsvдı񣬰λnameiterationssamples_ns
+		inline bool BenchmarkCsvRead(std::string_view s, mqlist<BenchmarkResult>& results) noexcept {
+			mqlist<std::string> fields;
+			mqui64 i{ };
+			// ȡһеȫֶΣڵĶ뻻ֶ
+			auto row{ [&] () noexcept {
+				fields.clear();
+				std::string field;
+				bool quoted{ };
+				for (; i < s.size(); ++i) {
+					auto c{ s[i] };
+					if (quoted) {
+						if (c == '"') {
+							if (i + 1ULL < s.size() && s[i + 1ULL] == '"') field.push_back(s[++i]);
+							else quoted = false;
+						}
+						else field.push_back(c);
+					}
+					else if (c == '"') quoted = true;
+					else if (c == ',') {
+						fields.add(freestanding::move(field));
+						field.clear();
+					}
+					else if (c == '\n') {
+						++i;
+						break;
+					}
+					else if (c != '\r') field.push_back(c);
+				}
+				fields.add(freestanding::move(field));
+			} };
+			row();
+			mqui64 name{ ~0ULL }, iterations{ ~0ULL }, samples{ ~0ULL }, counters[BenchmarkCounterCount]{ ~0ULL, ~0ULL, ~0ULL, ~0ULL };
+			for (mqui64 k{ }; k < fields.size(); ++k) {
+				if (fields[k] == "name") name = k;
+				else if (fields[k] == "iterations") iterations = k;
+				else if (fields[k] == "samples_ns") samples = k;
+				if (auto c{ BenchmarkCounterIndex(fields[k]) }; c < BenchmarkCounterCount) counters[c] = k;
+			}
+			if (name == ~0ULL || samples == ~0ULL) return false;
+			while (i < s.size()) {
+				row();
+				if (fields.size() <= samples || fields.size() <= name) continue;
+				BenchmarkResult r;
+				auto& n{ fields[name] };
+				r.name = ToString(BinView{ reinterpret_cast<mqcbytes>(n.data()), n.size() });
+				if (iterations < fields.size()) r.iterations = std::strtoull(fields[iterations].c_str(), nullptr, 10);
+				for (mqui64 c{ }; c < BenchmarkCounterCount; ++c) {
+					if (counters[c] < fields.size() && !fields[counters[c]].empty()) {
+						r.counters[c] = std::strtod(fields[counters[c]].c_str(), nullptr);
+						r.counterMask |= 1U << c;
+					}
+				}
+				auto p{ fields[samples].c_str() };
+				for (char* end{ }; ; p = end) {
+					auto v{ std::strtod(p, &end) };
+					if (end == p) break;
+					r.samples.add(v);
+				}
+				r.statistics();
+				results.add(freestanding::move(r));
+			}
+			return true;
+		}
+
+		inline bool BenchmarkWrite(mqhandle handle, std::string_view text) noexcept {
+			mqui32 written{ };
+			return api::WriteFile(handle, text.data(), static_cast<mqui32>(text.size()), &written, nullptr) && written == text.size();
+		}
+
+		// Mann-Whitney U飬bapֵ̬ƣУУ
+		inline double MannWhitneyGreater(mqlist<double> const& a, mqlist<double> const& b) noexcept {
+			auto n1{ a.size() }, n2{ b.size() }, n{ n1 + n2 };
+			if (n1 == 0ULL || n2 == 0ULL) return 1.0;
+			struct Item {
+				double value;
+				bool second;
+			};
+			mqlist<Item> all;
+			all.reserve(n);
+			for (auto v : a) all.add(v, false);
+			for (auto v : b) all.add(v, true);
+			std::sort(all.begin(), all.end(), [ ] (Item const& x, Item const& y) noexcept { return x.value < y.value; });
+			double rank{ }, ties{ };
+			for (mqui64 i{ }; i < n; ) {
+				auto j{ i };
+				while (j + 1ULL < n && all[j + 1ULL].value == all[i].value) ++j;
+				auto r{ static_cast<double>(i + j) / 2.0 + 1.0 };
+				auto t{ static_cast<double>(j - i + 1ULL) };
+				ties += t * t * t - t;
+				for (auto k{ i }; k <= j; ++k) {
+					if (all[k].second) rank += r;
+				}
+				i = j + 1ULL;
+			}
+			auto dn{ static_cast<double>(n) }, d1{ static_cast<double>(n1) }, d2{ static_cast<double>(n2) };
+			auto u{ rank - d2 * (d2 + 1.0) / 2.0 };
+			auto var{ d1 * d2 / 12.0 * ((dn + 1.0) - ties / (dn * (dn - 1.0))) };
+			if (var <= 0.0) return 1.0;
+			auto z{ (u - d1 * d2 / 2.0 - 0.5) / std::sqrt(var) };
+			return 0.5 * std::erfc(z / std::sqrt(2.0));
+		}
+	}
+
+	/// <summary>
+	/// ɱıUTF-8
+	/// </summary>
+	/// <param name="results"></param>
+	/// <param name="format">ʽ</param>
+	export [[nodiscard]] inline std::string BenchmarkReport(mqlist<BenchmarkResult> const& results, BenchmarkFormat format) noexcept {
+		switch (format) {
+		case BenchmarkFormat::JSON: return details::BenchmarkJson(results);
+		case BenchmarkFormat::CSV: return details::BenchmarkCsv(results);
+		default: return details::BenchmarkConsole(results);
+		}
+	}
+
+	/// <summary>
+	/// дļļ
+	/// </summary>
+	/// <param name="path">ļ·</param>
+	/// <param name="results"></param>
+	/// <param name="format">ʽĬΪJSON</param>
+	/// <returns>Ƿɹ</returns>
+	export inline bool BenchmarkSave(std::wstring_view path, mqlist<BenchmarkResult> const& results,
+		BenchmarkFormat format = BenchmarkFormat::JSON) noexcept {
+		std::wstring tmp{ path };
+		auto handle{ api::CreateFileW(tmp.data(), 0x40000000U, 0, nullptr, 2U, 0x00000080U, nullptr) };
+		if (handle == reinterpret_cast<mqhandle>(-1)) return false;
+		auto ok{ details::BenchmarkWrite(handle, BenchmarkReport(results, format)) };
+		api::CloseHandle(handle);
+		return ok;
+	}
+
+	/// <summary>
+	/// ȡBenchmarkSaveдJSONCSV棬ͳ¼
+	/// </summary>
+	/// <param name="path">ļ·</param>
+	/// <param name="results">׷ӶȡĽ</param>
+	/// <returns>Ƿɹ</returns>
+	export inline bool BenchmarkLoad(std::wstring_view path, mqlist<BenchmarkResult>& results) noexcept {
+		std::wstring tmp{ path };
+		auto handle{ api::CreateFileW(tmp.data(), 0x80000000U, 0x00000001U, nullptr, 3U, 0x00000080U, nullptr) };
+		if (handle == reinterpret_cast<mqhandle>(-1)) return false;
+		std::string text;
+		mqi64 size{ };
+		mqui32 read{ };
+		bool ok{ api::GetFileSizeEx(handle, &size) && size >= 0 && size < 0x7FFFFFFF };
+		if (ok) {
+			text.resize(static_cast<mqui64>(size));
+			ok = api::ReadFile(handle, text.data(), static_cast<mqui32>(size), &read, nullptr) && read == size;
+		}
+		api::CloseHandle(handle);
+		if (!ok) return false;
+		std::string_view s{ text };
+		if (s.starts_with("\xEF\xBB\xBF")) s.remove_prefix(3ULL);
+		auto first{ s.find_first_not_of(" \t\r\n") };
+		if (first != std::string_view::npos && s[first] == '{') {
+			return details::BenchmarkJsonReader{ s }.document(results);
+		}
+		return details::BenchmarkCsvRead(s, results);
+	}
+
+	// һмıȽ
+	export struct BenchmarkComparison {
+		std::wstring name;
+		double baseline{ }; // ׼λ
+		double contender{ }; // Աȵλ
+		double change{ }; // λԱ仯ʾ
+		double p{ 1.0 }; // Աڻ׼ĵMann-Whitney Upֵ
+		bool regression{ }; // pˮƽұֵ
+	};
+
+	/// <summary>
+	/// <para>ƱȽеMann-Whitney UжǷ</para>
+	/// <para>ֻһ񲻲Ƚϣÿظ鲻9</para>
+	/// </summary>
+	/// <param name="baseline">׼</param>
+	/// <param name="contender">ԱȽ</param>
+	/// <param name="alpha">ˮƽĬΪ0.05</param>
+	/// <param name="threshold">λСĬΪ0ֻ</param>
+	/// <returns>ȽϽ˳contenderһ</returns>
+	export [[nodiscard]] inline mqlist<BenchmarkComparison> BenchmarkCompare(mqlist<BenchmarkResult> const& baseline,
+		mqlist<BenchmarkResult> const& contender, double alpha = 0.05, double threshold = 0.0) noexcept {
+		mqlist<BenchmarkComparison> comparisons;
+		for (auto& c : contender) {
+			auto b{ std::find_if(baseline.begin(), baseline.end(), [&] (BenchmarkResult const& r) noexcept { return r.name == c.name; }) };
+			if (b == baseline.end()) continue;
+			auto& cmp{ comparisons.add() };
+			cmp.name = c.name;
+			cmp.baseline = b->median;
+			cmp.contender = c.median;
+			cmp.change = b->median > 0.0 ? (c.median - b->median) / b->median : 0.0;
+			cmp.p = details::MannWhitneyGreater(b->samples, c.samples);
+			cmp.regression = cmp.p < alpha && cmp.change > threshold;
+		}
+		return comparisons;
+	}
+
+	/// <summary>
+	/// ȽϽıUTF-8
+	/// </summary>
+	export [[nodiscard]] inline std::string BenchmarkCompareReport(mqlist<BenchmarkComparison> const& comparisons) noexcept {
+		char line[256]{ };
+		std::string buf;
+		std::snprintf(line, sizeof(line), "%-40s %12s %12s %10s %10s\n", "Benchmark", "Baseline", "Contender", "Change", "p-value");
+		buf += line;
+		buf.append(88ULL, '-');
+		buf += '\n';
+		for (auto& c : comparisons) {
+			auto name{ ToBin(c.name) };
+			std::snprintf(line, sizeof(line), "%-40.*s %12s %12s %+9.2f%% %10.4f%s\n",
+				static_cast<int>(name.size()), reinterpret_cast<mqcstra>(name.data()),
+				details::BenchmarkTime(c.baseline).c_str(), details::BenchmarkTime(c.contender).c_str(),
+				c.change * 100.0, c.p, c.regression ? "  REGRESSION" : "");
+			buf += line;
+		}
+		return buf;
 	}
 
 	/// <summary>
-	/// <para>Google benchmark [ Source: https://github.com/google/benchmark ]</para>
+	/// <para>׼ԣMonotonicClockʱ</para>
+	/// <para>ÿԤȣУ׼ʹμʱMinTime֮ظʱRepetitionsβͳ</para>
 	/// </summary>
 	/// <example>
 	/// <para>[1:Benchmark]</para>
@@ -43,10 +803,8 @@ namespace MasterQian::Tool {
 	///		}).Run();
 	/// }
 	/// </code>
-	/// <para>BenchmarkʱֻҪֻܳʼһ</para>
-	/// <para>ͨAddһ, Addʽ</para>
-	/// <para>ͨRun</para>
-	/// <para>һһָ, Ժܷʹlambdaʽ</para>
+	/// <para>ͨAdd, Addʽ</para>
+	/// <para>ͨRun, Runȫ</para>
 	/// <para>򽫶10000Ӧַbenchmark</para>
 	/// </example>
 	/// <example>
@@ -61,47 +819,201 @@ namespace MasterQian::Tool {
 	///		}, { 100, 1000, 10000, 100000 }, 10, L"test").Run();
 	/// }
 	/// </code>
-	/// <para>Яʱںָ󲹳˲б, Addĺǵ, ʡ, ĬֱֵΪ1Ϳ,</para>
-	/// <para>֧κ(), ҪAddģ崦ʽ, int</para>
-	/// <para>бԷʹóʼб{ }</para>
-	/// <para>ںص, auto argʽػòָ, autoָint*</para>
-	/// <para>򽫷ֱ100, 1000, 10000, 100000ӦַĴbenchmark</para>
+	/// <para>Яʱںָ󲹳˲б, Addĺǵ, ʡ</para>
+	/// <para>Ϊ0ʱԶУ׼, беÿһ, test/100</para>
+	/// </example>
+	/// <example>
+	/// <para>[3:lambdaо]</para>
+	/// <code>
+	/// struct Sort {
+	///		mqlist<int> data;
+	///		void setup() noexcept { ... } // ѡÿμʱǰãʱ
+	///		void run() noexcept { std::sort(data.begin(), data.end()); DoNotOptimize(data.data()); }
+	///		void teardown() noexcept { ... } // ѡÿμʱ
+	/// };
+	///
+	/// Benchmark().Repetitions(20).MinTime(200)
+	///		.Add(L"to_string", [ ] () noexcept { DoNotOptimize(std::to_string(12345)); })
+	///		.AddFixture<Sort>(L"sort")
+	///		.Run();
+	/// </code>
 	/// </example>
-	
-
-	/// <summary>
-	/// benchmark
-	/// </summary>
 	export struct Benchmark {
 		template<typename Arg>
 		using Function = void(__stdcall*)(Arg const* arg) noexcept;
 
 		struct nullarg {};
+	private:
+		mqlist<details::BenchmarkCase> cases;
+		std::wstring filter;
+		mqlist<std::pair<std::wstring, BenchmarkFormat>> outputs;
+		mqui64 repetitions{ 10ULL };
+		mqui64 minTime{ 100000000ULL }; // 
+		mqui64 warmUp{ 100000000ULL }; // 
+		bool counters{ };
+
+		Benchmark& _add(std::wstring_view name, mqmem ctx, void(*run)(mqmem, mqui64) noexcept,
+			void(*setup)(mqmem) noexcept, void(*teardown)(mqmem) noexcept, void(*destroy)(mqmem) noexcept, mqui64 count) noexcept {
+			std::wstring tmp{ name };
+			if (tmp.empty()) {
+				tmp = L"#" + std::to_wstring(cases.size());
+			}
+			cases.add(details::BenchmarkCase{ freestanding::move(tmp), ctx, run, setup, teardown, destroy, count });
+			return *this;
+		}
 
-		Benchmark() noexcept {
-			details::MasterQian_Tool_Benchmark_BenchmarkInitialize();
+		// ʱһ룻totalsǿʱۼӲֵдmask
+		static mqui64 _batch(details::BenchmarkCase const& c, mqui64 n,
+			mqui64 (*totals)[details::BenchmarkCounterCount] = nullptr, mqui32* mask = nullptr) noexcept {
+			mqui64 begin[details::BenchmarkCounterCount]{ }, end[details::BenchmarkCounterCount]{ };
+			if (c.setup) c.setup(c.ctx);
+			if (totals) *mask = details::BenchmarkCounterRead(begin);
+			Stopwatch sw;
+			c.run(c.ctx, n);
+			auto ns{ sw.nanoseconds() };
+			if (totals) {
+				*mask &= details::BenchmarkCounterRead(end);
+				for (mqui64 k{ }; k < details::BenchmarkCounterCount; ++k) {
+					(*totals)[k] += end[k] - begin[k];
+				}
+			}
+			if (c.teardown) c.teardown(c.ctx);
+			return ns;
 		}
 
+		// ֱμʱminTime
+		mqui64 _calibrate(details::BenchmarkCase const& c) const noexcept {
+			mqui64 n{ 1ULL };
+			for (;;) {
+				auto ns{ _batch(c, n) };
+				if (ns >= minTime || n >= details::BenchmarkMaxIterations) return n;
+				double multiplier{ 10.0 };
+				if (ns * 10ULL > minTime) {
+					multiplier = 1.4 * static_cast<double>(minTime) / static_cast<double>(ns);
+				}
+				auto next{ static_cast<mqui64>(static_cast<double>(n) * multiplier) };
+				n = std::min(std::max(next, n + 1ULL), details::BenchmarkMaxIterations);
+			}
+		}
+
+		BenchmarkResult _measure(details::BenchmarkCase const& c) const noexcept {
+			BenchmarkResult result;
+			result.name = c.name;
+			for (Stopwatch sw; sw.nanoseconds() < warmUp; ) {
+				_batch(c, c.iterations ? c.iterations : 1ULL);
+			}
+			result.iterations = c.iterations ? c.iterations : _calibrate(c);
+			result.samples.reserve(repetitions);
+			mqui64 totals[details::BenchmarkCounterCount]{ };
+			result.counterMask = counters ? ~0U : 0U;
+			for (mqui64 i{ }; i < repetitions; ++i) {
+				mqui32 mask{ };
+				result.samples.add(static_cast<double>(_batch(c, result.iterations, counters ? &totals : nullptr, &mask)) / static_cast<double>(result.iterations));
+				result.counterMask &= mask;
+			}
+			for (mqui64 k{ }; k < details::BenchmarkCounterCount; ++k) {
+				result.counters[k] = static_cast<double>(totals[k]) / static_cast<double>(repetitions * result.iterations);
+			}
+			result.statistics();
+			return result;
+		}
+
+	public:
+		Benchmark() noexcept = default;
+
 		Benchmark(Benchmark const&) = delete;
 		Benchmark(Benchmark&&) = delete;
 		Benchmark& operator = (Benchmark const&) = delete;
 		Benchmark& operator = (Benchmark&&) = delete;
 
 		~Benchmark() noexcept {
-			details::MasterQian_Tool_Benchmark_BenchmarkShutdown();
+			for (auto& c : cases) {
+				c.destroy(c.ctx);
+			}
+		}
+
+		/// <summary>
+		/// ÿظʱĬΪ10
+		/// </summary>
+		Benchmark& Repetitions(mqui64 count) noexcept {
+			repetitions = count ? count : 1ULL;
+			return *this;
+		}
+
+		/// <summary>
+		/// ԶУ׼ʱμʱʱ䣬λΪ룬ĬΪ100
+		/// </summary>
+		Benchmark& MinTime(mqui64 ms) noexcept {
+			minTime = ms * 1000000ULL;
+			return *this;
+		}
+
+		/// <summary>
+		/// ÿʱǰԤʱ䣬λΪ룬ĬΪ100
+		/// </summary>
+		Benchmark& WarmUp(mqui64 ms) noexcept {
+			warmUp = ms * 1000000ULL;
+			return *this;
+		}
+
+		/// <summary>
+		/// <para>ʱʱͬʱɼӲĬϹرգбиÿεľֵ</para>
+		/// <para>ǰƽֵ̨֧ļΪãӰʱ</para>
+		/// </summary>
+		Benchmark& Counters(bool enable = true) noexcept {
+			counters = enable;
+			return *this;
+		}
+
+		/// <summary>
+		/// ֻưfilterΪʱȫ
+		/// </summary>
+		Benchmark& Filter(std::wstring_view name) noexcept {
+			filter = name;
+			return *this;
+		}
+
+		/// <summary>
+		/// Run󽫱浽ļɶεָʽ
+		/// </summary>
+		/// <param name="path">ļ·</param>
+		/// <param name="format">ʽĬΪJSON</param>
+		Benchmark& Output(std::wstring_view path, BenchmarkFormat format = BenchmarkFormat::JSON) noexcept {
+			outputs.add(std::wstring{ path }, format);
+			return *this;
 		}
 
 		/// <summary>
 		/// в
 		/// </summary>
 		/// <param name="func">Ժ</param>
-		/// <param name="args"></param>
-		/// <param name="count">ĬΪ1</param>
+		/// <param name="args">ϣÿһ</param>
+		/// <param name="count">ĬΪ0ԶУ׼</param>
 		/// <param name="name">ĬΪ</param>
 		/// <typeparam name="Arg"></typeparam>
 		template<typename Arg>
-		Benchmark& Add(Function<Arg> func, mqlist<Arg> const& args, mqui64 count = 1ULL, std::wstring_view name = L"") noexcept {
-			details::MasterQian_Tool_Benchmark_BenchmarkAdd(func, args.begin(), args.size(), sizeof(Arg), count, name.data());
+		Benchmark& Add(Function<Arg> func, mqlist<Arg> const& args, mqui64 count = 0ULL, std::wstring_view name = L"") noexcept {
+			struct Bound {
+				Function<Arg> func;
+				Arg arg;
+
+				void operator () () const noexcept {
+					func(&arg);
+				}
+			};
+			for (mqui64 i{ }; i < args.size(); ++i) {
+				std::wstring tmp{ name };
+				if constexpr (!freestanding::same<Arg, nullarg>) {
+					if constexpr (requires { std::to_wstring(args[i]); }) {
+						tmp += L"/" + std::to_wstring(args[i]);
+					}
+					else {
+						tmp += L"/" + std::to_wstring(i);
+					}
+				}
+				_add(tmp, new Bound{ func, args[i] }, details::BenchmarkRunCallable<Bound>,
+					nullptr, nullptr, details::BenchmarkDestroy<Bound>, count);
+			}
 			return *this;
 		}
 
@@ -109,17 +1021,73 @@ namespace MasterQian::Tool {
 		/// ޲
 		/// </summary>
 		/// <param name="func">Ժ</param>
-		/// <param name="count">ĬΪ1</param>
+		/// <param name="count">ĬΪ0ԶУ׼</param>
 		/// <param name="name">ĬΪ</param>
-		Benchmark& Add(Function<nullarg> func, mqui64 count = 1ULL, std::wstring_view name = L"") noexcept {
+		Benchmark& Add(Function<nullarg> func, mqui64 count = 0ULL, std::wstring_view name = L"") noexcept {
 			return Add(func, { { } }, count, name);
 		}
 
 		/// <summary>
-		/// 
+		/// ӿɵö
+		/// </summary>
+		/// <param name="name"></param>
+		/// <param name="func">޲οɵöÿεһ</param>
+		/// <param name="count">ĬΪ0ԶУ׼</param>
+		template<typename Func>
+		requires requires (freestanding::remove_cvref<Func>& f) { f(); }
+		Benchmark& Add(std::wstring_view name, Func&& func, mqui64 count = 0ULL) noexcept {
+			using F = freestanding::remove_cvref<Func>;
+			return _add(name, new F{ freestanding::forward<Func>(func) }, details::BenchmarkRunCallable<F>,
+				nullptr, nullptr, details::BenchmarkDestroy<F>, count);
+		}
+
+		/// <summary>
+		/// <para>Ӽо񣬼оĬϹһΣÿεrun</para>
+		/// <para>ѡsetupteardownÿμʱǰãʱ</para>
+		/// </summary>
+		/// <param name="name"></param>
+		/// <param name="count">ĬΪ0ԶУ׼</param>
+		/// <typeparam name="Fixture">о</typeparam>
+		template<typename Fixture>
+		requires requires (Fixture& f) { f.run(); }
+		Benchmark& AddFixture(std::wstring_view name, mqui64 count = 0ULL) noexcept {
+			void(*setup)(mqmem) noexcept { };
+			void(*teardown)(mqmem) noexcept { };
+			if constexpr (requires (Fixture& f) { f.setup(); }) {
+				setup = [ ] (mqmem ctx) noexcept { static_cast<Fixture*>(ctx)->setup(); };
+			}
+			if constexpr (requires (Fixture& f) { f.teardown(); }) {
+				teardown = [ ] (mqmem ctx) noexcept { static_cast<Fixture*>(ctx)->teardown(); };
+			}
+			return _add(name, new Fixture{ }, details::BenchmarkRunFixture<Fixture>,
+				setup, teardown, details::BenchmarkDestroy<Fixture>, count);
+		}
+
+		/// <summary>
+		/// ׼ӡ沢дOutputָļдʧʱڱ׼ʾ
 		/// </summary>
-		void Run() noexcept {
-			details::MasterQian_Tool_Benchmark_BenchmarkRun();
+		/// <returns>˳˳һ</returns>
+		mqlist<BenchmarkResult> Run() noexcept {
+			mqlist<BenchmarkResult> results;
+			for (auto& c : cases) {
+				if (filter.empty() || c.name.find(filter) != std::wstring::npos) {
+					results.add(_measure(c));
+				}
+			}
+			details::BenchmarkWrite(api::GetStdHandle(static_cast<mqui32>(-11)), details::BenchmarkConsole(results));
+			if (counters && results.size() && std::none_of(results.begin(), results.end(), [ ] (BenchmarkResult const& r) noexcept { return r.counterMask != 0U; })) {
+				details::BenchmarkWrite(api::GetStdHandle(static_cast<mqui32>(-12)), "hardware counters unavailable\n");
+			}
+			for (auto& [path, format] : outputs) {
+				if (!BenchmarkSave(path, results, format)) {
+					auto name{ ToBin(path) };
+					std::string msg{ "failed to write " };
+					msg.append(reinterpret_cast<mqcstra>(name.data()), name.size());
+					msg += '\n';
+					details::BenchmarkWrite(api::GetStdHandle(static_cast<mqui32>(-12)), msg);
+				}
+			}
+			return results;
 		}
 	};
-}
\ No newline at end of file
+}